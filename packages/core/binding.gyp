@@ -2,6 +2,29 @@
   "targets": [
     {
       "target_name": "quantum",
+      "sources": [
+        "../crypto/src/native/quantum.cpp",
+        "../crypto/src/native/security_monitor.cpp",
+        "../crypto/src/native/entropy_pool.cpp",
+        "../crypto/src/native/thread_pool.cpp",
+        "../crypto/src/native/hybrid_hash.cpp",
+        "../crypto/src/native/keccak.cpp",
+        "../crypto/src/native/hash_engine.cpp",
+        "../crypto/src/native/miner.cpp",
+        "../crypto/src/native/merkle.cpp",
+        "../crypto/src/native/verify_cache.cpp",
+        "../crypto/src/native/secure_arena.cpp",
+        "../crypto/src/native/key_registry.cpp",
+        "../crypto/src/native/keypair_pool.cpp",
+        "../crypto/src/native/health_monitor.cpp",
+        "../crypto/src/native/prehash.cpp",
+        "../crypto/src/native/prepared_keys.cpp",
+        "../crypto/src/native/secp256k1.cpp",
+        "../crypto/src/native/async_dispatcher.cpp",
+        "../crypto/src/native/addon.cpp"
+      ],
+      "defines": [ "NAPI_VERSION=8", "NAPI_CPP_EXCEPTIONS" ],
+      "cflags_cc": [ "-std=c++17" ],
       "include_dirs": [
         "<!(node -p \"require('node-addon-api').include\")"
       ],
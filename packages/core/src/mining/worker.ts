@@ -1,5 +1,5 @@
 import { parentPort } from 'worker_threads';
-import { SIMD } from '@h3tag-blockchain/crypto';
+import { nativeQuantum } from '@h3tag-blockchain/crypto';
 
 interface MiningTask {
   start: number;
@@ -7,6 +7,7 @@ interface MiningTask {
   target: string;
   headerBase: string;
   batchSize?: number;
+  threads?: number;
 }
 
 export interface MiningResult {
@@ -38,6 +39,7 @@ export interface MiningResult {
  * @property {string} target - Mining target difficulty
  * @property {string} headerBase - Base block header data
  * @property {number} [batchSize] - Optional batch size for processing
+ * @property {number} [threads] - Native mining threads for this worker (default 1)
  */
 
 /**
@@ -125,6 +127,8 @@ export interface MiningResult {
 
 export class MiningWorker {
   private static readonly DEFAULT_BATCH_SIZE = 1000;
+  // Nonces per native call; sized so progress is still reported regularly.
+  private static readonly NATIVE_SLICE_SIZE = 1000000;
   private static readonly REPORT_INTERVAL = 5000; // 5 seconds
   private isInitialized = false;
   private lastReportTime = 0;
@@ -135,7 +139,7 @@ export class MiningWorker {
 
   private async initialize(): Promise<void> {
     try {
-      await SIMD.initialize();
+      nativeQuantum.checkInitialization();
       this.isInitialized = true;
     } catch (error) {
       parentPort?.postMessage({
@@ -170,6 +174,7 @@ export class MiningWorker {
     target,
     headerBase,
     batchSize = MiningWorker.DEFAULT_BATCH_SIZE,
+    threads = 1,
   }: MiningTask): Promise<void> {
     if (!this.isInitialized) {
       await this.initialize();
@@ -187,29 +192,39 @@ export class MiningWorker {
     }
 
     try {
-      const targetBigInt = BigInt(target);
-
-      for (let nonce = start; nonce < end; nonce += batchSize) {
-        const hashes = await SIMD.batchHashSHA3(headerBase, nonce, batchSize);
-        this.hashesProcessed += BigInt(hashes.length);
+      const targetBuffer = Buffer.from(
+        BigInt(target).toString(16).padStart(64, '0'),
+        'hex',
+      );
+      if (targetBuffer.length !== 32) {
+        throw new Error('Target exceeds 256 bits');
+      }
 
-        for (let i = 0; i < hashes.length; i++) {
-          const currentNonce = nonce + i;
-          if (currentNonce >= end) break; // Prevent overflow
+      const sliceSize = Math.max(batchSize, MiningWorker.NATIVE_SLICE_SIZE);
+      const generation = nativeQuantum.getMiningGeneration();
+      for (let nonce = start; nonce < end; nonce += sliceSize) {
+        const result = await nativeQuantum.mine({
+          headerBase,
+          start: nonce,
+          end: Math.min(nonce + sliceSize, end),
+          target: targetBuffer,
+          threads,
+          generation,
+        });
+        this.hashesProcessed += BigInt(result.hashes);
 
-          const hash = hashes[i];
-          if (!hash) continue; // Skip invalid hashes
+        if (result.cancelled) {
+          break;
+        }
 
-          const hashBigInt = BigInt(`0x${hash}`);
-          if (hashBigInt <= targetBigInt) {
-            parentPort?.postMessage({
-              found: true,
-              nonce: currentNonce,
-              hash,
-              hashRate: this.calculateHashRate(),
-            });
-            return;
-          }
+        if (result.found && result.hash) {
+          parentPort?.postMessage({
+            found: true,
+            nonce: result.nonce,
+            hash: result.hash.toString('hex'),
+            hashRate: this.calculateHashRate(),
+          });
+          return;
         }
 
         // Report progress periodically
@@ -223,16 +238,6 @@ export class MiningWorker {
             hashRate: this.calculateHashRate(),
           });
         }
-
-        // Optional GC with reduced frequency: only allow explicit GC if an env flag is set.
-        if (
-          process.env.NODE_ENV !== 'production' &&
-          global.gc &&
-          Math.random() < 0.001
-        ) {
-          // 0.1% chance to GC (only if --expose-gc is used and not in production)
-          global.gc();
-        }
       }
 
       parentPort?.postMessage({
@@ -1,6 +1,7 @@
 import { Logger } from '@h3tag-blockchain/shared';
 import { Block, BlockHeader } from '../models/block.model';
 import { Transaction, TxInput, TxOutput } from '../models/transaction.model';
+import { QuantumNative } from '@h3tag-blockchain/crypto';
 
 /**
  * @fileoverview Metrics collection system for the H3Tag blockchain. Includes performance metrics,
@@ -17,6 +18,7 @@ import { Transaction, TxInput, TxOutput } from '../models/transaction.model';
  * @property {Map<string, number>} timers - Active metric timers
  * @property {string} namespace - Metrics namespace identifier
  * @property {NodeJS.Timeout} flushInterval - Timer for periodic metric flushing
+ * @property {boolean} collectCrypto - Whether each flush samples native crypto metrics
  *
  * @example
  * const collector = new MetricsCollector("blockchain");
@@ -28,6 +30,7 @@ export class MetricsCollector {
   private metrics: Map<string, number>;
   private timers: Map<string, number>;
   private readonly namespace: string;
+  private readonly collectCrypto: boolean;
   private flushInterval: NodeJS.Timeout | null;
   private readonly FLUSH_INTERVAL_MS = 60000; // 1 minute default
   private isFlushing = false;
@@ -36,14 +39,22 @@ export class MetricsCollector {
    * Creates a new MetricsCollector instance
    * @param {string} namespace - Metrics namespace
    * @param {number} [flushIntervalMs=60000] - Metrics flush interval in milliseconds
+   * @param {boolean} [collectCrypto=false] - Sample native crypto metrics before
+   * each flush. The native counters are process-wide, so enable it on one
+   * collector only.
    * @throws {Error} If namespace is not provided
    */
-  constructor(namespace: string, flushIntervalMs = 60000) {
+  constructor(
+    namespace: string,
+    flushIntervalMs = 60000,
+    collectCrypto = false,
+  ) {
     if (!namespace) {
       throw new Error('Namespace is required');
     }
 
     this.namespace = namespace;
+    this.collectCrypto = collectCrypto;
     this.metrics = new Map();
     this.timers = new Map();
 
@@ -177,6 +188,9 @@ export class MetricsCollector {
     }
     this.isFlushing = true;
     try {
+      if (this.collectCrypto) {
+        this.collectCryptoMetrics();
+      }
       if (this.metrics.size > 0) {
         Logger.info('Flushing metrics:', Array.from(this.metrics.entries()));
         this.metrics.clear();
@@ -211,6 +225,31 @@ export class MetricsCollector {
     }
   }
 
+  /**
+   * Copies the native crypto latency snapshot into gauges named
+   * crypto.<operation>.{count,failures,p50_us,p99_us,p999_us}. The quantiles
+   * cover the last one to two minutes; taking the snapshot never pauses
+   * the native threads.
+   */
+  public collectCryptoMetrics(): void {
+    try {
+      const native = QuantumNative.getInstance();
+      for (const op of native.getOperationMetrics()) {
+        const prefix = `crypto.${op.operation}`;
+        this.gauge(`${prefix}.count`, op.count);
+        this.gauge(`${prefix}.failures`, op.failures);
+        this.gauge(`${prefix}.p50_us`, op.p50Micros);
+        this.gauge(`${prefix}.p99_us`, op.p99Micros);
+        this.gauge(`${prefix}.p999_us`, op.p999Micros);
+      }
+      const cache = native.getVerifyCacheStats();
+      this.gauge('crypto.verify.cache_hits', cache.hits);
+      this.gauge('crypto.verify.cache_misses', cache.misses);
+    } catch (error) {
+      Logger.error('Failed to collect crypto metrics:', error);
+    }
+  }
+
   /**
    * Cleans up collector resources
    */
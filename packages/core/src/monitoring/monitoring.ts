@@ -2,6 +2,7 @@ import prometheus from 'prom-client';
 import winston from 'winston';
 import { hostname } from 'os';
 import { Mutex } from 'async-mutex';
+import { QuantumNative } from '@h3tag-blockchain/crypto';
 
 /**
  * @fileoverview Monitoring system for the H3Tag blockchain. Includes performance tracking,
@@ -25,6 +26,23 @@ export class MonitoringError extends Error {
   }
 }
 
+// Empty until the native module is initialized
+function readCryptoMetrics() {
+  try {
+    return QuantumNative.getInstance().getOperationMetrics();
+  } catch {
+    return [];
+  }
+}
+
+function readVerifyCacheStats() {
+  try {
+    return QuantumNative.getInstance().getVerifyCacheStats();
+  } catch {
+    return undefined;
+  }
+}
+
 /**
  * @class Monitoring
  * @description Core monitoring system for blockchain operations
@@ -68,6 +86,52 @@ export class Monitoring {
     buckets: [0.05, 0.1, 0.25, 0.5, 1, 2.5, 5],
   });
 
+  // Native crypto latency, read from the native histograms at scrape time
+  private cryptoLatency = new prometheus.Gauge({
+    name: 'crypto_operation_latency_seconds',
+    help: 'Native crypto operation latency quantiles over the last 1-2 minutes',
+    labelNames: ['operation', 'quantile'],
+    collect() {
+      for (const op of readCryptoMetrics()) {
+        const { operation } = op;
+        this.set({ operation, quantile: '0.5' }, op.p50Micros / 1e6);
+        this.set({ operation, quantile: '0.9' }, op.p90Micros / 1e6);
+        this.set({ operation, quantile: '0.99' }, op.p99Micros / 1e6);
+        this.set({ operation, quantile: '0.999' }, op.p999Micros / 1e6);
+      }
+    },
+  });
+
+  // Counters mirror the native totals: each scrape resets them and adds the
+  // current count, which only ever grows while the process runs
+  private cryptoOperations = new prometheus.Counter({
+    name: 'crypto_operations_total',
+    help: 'Native crypto operations since start, by result',
+    labelNames: ['operation', 'result'],
+    collect() {
+      this.reset();
+      for (const op of readCryptoMetrics()) {
+        const { operation } = op;
+        this.inc({ operation, result: 'ok' }, op.count - op.failures);
+        this.inc({ operation, result: 'failed' }, op.failures);
+      }
+    },
+  });
+
+  private verifyCacheLookups = new prometheus.Counter({
+    name: 'crypto_verify_cache_lookups_total',
+    help: 'Native signature verification cache lookups since start, by result',
+    labelNames: ['result'],
+    collect() {
+      this.reset();
+      const cache = readVerifyCacheStats();
+      if (cache) {
+        this.inc({ result: 'hit' }, cache.hits);
+        this.inc({ result: 'miss' }, cache.misses);
+      }
+    },
+  });
+
   private readonly mutex = new Mutex();
 
   constructor() {
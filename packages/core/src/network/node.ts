@@ -128,7 +128,8 @@ export class Node {
       port: this.config.port,
     });
 
-    this.metrics = new MetricsCollector('node');
+    // The node's collector also samples the process-wide crypto metrics
+    this.metrics = new MetricsCollector('node', 60000, true);
     this.health = new HealthMonitor({
       interval: 60000,
       thresholds: {
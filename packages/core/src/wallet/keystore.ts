@@ -279,7 +279,7 @@ export class Keystore {
   }
 
   private static async generateSecureIV(): Promise<Buffer> {
-    return crypto.randomBytes(16);
+    return HybridCrypto.generateRandomBytes(16);
   }
 
   private static async deriveMultipleKeys(
@@ -7,6 +7,7 @@ import { KeyManager } from './keys';
 import { HybridKeyPair } from './keys';
 import { QuantumWrapper } from './quantum-wrapper';
 import { ec as EC } from 'elliptic';
+import { nativeQuantum } from './native/quantum.node';
 
 export class HybridError extends Error {
   constructor(message: string) {
@@ -137,6 +138,33 @@ export class HybridCrypto {
     }
   }
 
+  /**
+   * Verifies a secp256k1 ECDSA signature and a Dilithium signature over the
+   * same message in one native call, with both checks running in parallel
+   * and off the event loop. The classical signature (DER) and key are hex,
+   * as elsewhere in this class; the Dilithium ones are base64.
+   */
+  static async verifyNative(
+    message: string,
+    eccSignature: string,
+    eccPublicKey: string,
+    dilithiumSignature: string,
+    dilithiumPublicKey: string,
+  ): Promise<boolean> {
+    try {
+      return await nativeQuantum.verifyHybrid(
+        Buffer.from(message, 'utf8'),
+        Buffer.from(eccSignature, 'hex'),
+        Buffer.from(eccPublicKey, 'hex'),
+        Buffer.from(dilithiumSignature, 'base64'),
+        Buffer.from(dilithiumPublicKey, 'base64'),
+      );
+    } catch (error) {
+      Logger.error('Hybrid verification failed:', error);
+      return false;
+    }
+  }
+
   static async encrypt(message: string, publicKey: string, iv?: string): Promise<string> {
     try {
       if (!message || !publicKey) {
@@ -420,20 +448,15 @@ export class HybridCrypto {
 
   public static async calculateHybridHash(data: Buffer): Promise<string> {
     try {
-      const keyPair = await this.generateKeyPair();
-      const privateKey =
-        typeof keyPair.privateKey === 'function'
-          ? await keyPair.privateKey()
-          : keyPair.privateKey;
+      const serialized = JSON.stringify(data);
 
-      // Generate quantum hash.
-      const quantumHash = await Dilithium.sign(
-        JSON.stringify(data),
-        privateKey,
-      );
+      // Keyless native quantum hash (deterministic for the same input).
+      const quantumHash = nativeQuantum
+        .hybridHash(Buffer.from(serialized))
+        .toString('hex');
 
       // Generate traditional hash.
-      const traditionalHash = HashUtils.sha256(JSON.stringify(data));
+      const traditionalHash = HashUtils.sha256(serialized);
 
       // Combine hashes.
       return this.deriveAddress({
@@ -449,10 +472,8 @@ export class HybridCrypto {
 
   /**
    * Hashes a given string using a hybrid approach.
-   * The function generates keypairs first, then hashes the data using:
-   * - Dilithium quantum signature
-   * - Kyber encapsulation
-   * - SHA-256 hash of the data
+   * Combines a SHA-256 hash of the data with the native keyless hybrid
+   * hash (SHA3-512 + SHAKE256 with domain separation).
    *
    * The function returns the SHA-3 hash of the combined hashes.
    *
@@ -464,25 +485,13 @@ export class HybridCrypto {
       // Traditional hash.
       const traditionalHash = HashUtils.sha256(data);
 
-      // Generate keypairs first.
-      const keyPair = await this.generateKeyPair();
-      const privateKey =
-        typeof keyPair.privateKey === 'function'
-          ? await keyPair.privateKey()
-          : keyPair.privateKey;
-      const publicKey =
-        typeof keyPair.publicKey === 'function'
-          ? await keyPair.publicKey()
-          : keyPair.publicKey;
-
-      // Generate quantum hashes.
-      const [dilithiumHash, kyberHash] = await Promise.all([
-        Dilithium.sign(data, privateKey),
-        Kyber.encapsulate(publicKey).then((result) => result.sharedSecret),
-      ]);
+      // Quantum-resistant hash.
+      const quantumHash = nativeQuantum
+        .hybridHash(Buffer.from(data))
+        .toString('hex');
 
       // Combine all hashes.
-      return HashUtils.sha3(traditionalHash + dilithiumHash + kyberHash);
+      return HashUtils.sha3(traditionalHash + quantumHash);
     } catch (error) {
       Logger.error('Hash generation failed:', error);
       throw new HybridError(
@@ -493,10 +502,7 @@ export class HybridCrypto {
 
   public static async generateRandomBytes(length: number): Promise<Buffer> {
     try {
-      return Buffer.from(
-        CryptoJS.lib.WordArray.random(length).toString(),
-        'hex',
-      );
+      return nativeQuantum.randomBytes(length);
     } catch (error) {
       Logger.error('Random bytes generation failed:', error);
       throw new HybridError(
@@ -0,0 +1,1871 @@
+// N-API binding exposing QuantumCrypto to JavaScript (see types.ts
+// NativeQuantum). Every cryptographic operation runs on the addon's own
+// worker pool via AsyncDispatcher and resolves a promise; results are handed
+// to JS as Buffers that own the native secure allocation. Inputs are read
+// in place from the caller's Buffers, which stay pinned until the promise
+// settles and must not be modified meanwhile.
+
+#include <napi.h>
+#include "quantum.h"
+#include "async_dispatcher.h"
+#include "hybrid_hash.h"
+#include "hash_engine.h"
+#include "miner.h"
+#include "merkle.h"
+#include <openssl/rand.h>
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstdlib>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace quantum
+{
+    namespace
+    {
+        // Two pools run native work: the dispatcher's, which executes every
+        // async call, and QuantumCrypto's, which batch calls fan out onto
+        // with parallelFor while the dispatcher thread joins in. Sizing both
+        // to the core count would oversubscribe the CPU twice over during
+        // batches, so by default the cores are split between them.
+        size_t defaultWorkerThreads()
+        {
+            if (const char *configured = std::getenv("H3TAG_CRYPTO_THREADS"))
+            {
+                long threads = std::strtol(configured, nullptr, 10);
+                if (threads > 0)
+                {
+                    return static_cast<size_t>(threads);
+                }
+            }
+            return std::max(1u, std::thread::hardware_concurrency() / 2);
+        }
+
+        SecurityParams cryptoParams(size_t dispatcherThreads)
+        {
+            SecurityParams params = SecurityParams::DEFAULT;
+            if (params.workerThreads == 0)
+            {
+                size_t cores = std::max(1u, std::thread::hardware_concurrency());
+                params.workerThreads = static_cast<uint32_t>(cores > dispatcherThreads ? cores - dispatcherThreads : 1);
+            }
+            return params;
+        }
+
+        Napi::Buffer<uint8_t> requireBuffer(const Napi::CallbackInfo &info, size_t index, const char *name)
+        {
+            if (info.Length() <= index || !info[index].IsBuffer())
+            {
+                throw Napi::TypeError::New(info.Env(), std::string(name) + " must be a Buffer");
+            }
+            auto buffer = info[index].As<Napi::Buffer<uint8_t>>();
+            if (buffer.Length() == 0)
+            {
+                throw Napi::TypeError::New(info.Env(), std::string(name) + " must not be empty");
+            }
+            return buffer;
+        }
+
+        // Parameter set argument mirrored from types.ts SecurityLevel;
+        // omitted or undefined means the current default.
+        SecurityLevel optionalLevel(const Napi::CallbackInfo &info, size_t index, const QuantumCrypto &crypto)
+        {
+            if (info.Length() <= index || info[index].IsUndefined())
+            {
+                return crypto.securityLevel();
+            }
+            if (!info[index].IsNumber())
+            {
+                throw Napi::TypeError::New(info.Env(), "level must be a number");
+            }
+            uint32_t level = info[index].As<Napi::Number>().Uint32Value();
+            if (level >= SECURITY_LEVEL_COUNT)
+            {
+                throw Napi::RangeError::New(info.Env(), "Unknown security level");
+            }
+            return static_cast<SecurityLevel>(level);
+        }
+
+        // Falcon variant argument: 512 or 1024, default 512
+        FalconVariant optionalFalconVariant(const Napi::CallbackInfo &info, size_t index)
+        {
+            if (info.Length() <= index || info[index].IsUndefined())
+            {
+                return FalconVariant::FALCON_512;
+            }
+            if (!info[index].IsNumber())
+            {
+                throw Napi::TypeError::New(info.Env(), "variant must be a number");
+            }
+            switch (info[index].As<Napi::Number>().Uint32Value())
+            {
+            case 512:
+                return FalconVariant::FALCON_512;
+            case 1024:
+                return FalconVariant::FALCON_1024;
+            default:
+                throw Napi::RangeError::New(info.Env(), "Falcon variant must be 512 or 1024");
+            }
+        }
+
+        // Copy a JS Buffer argument into native memory on the JS thread so
+        // the worker never touches memory owned by V8. PrivateKey copies land
+        // on the secure heap.
+        template <typename T = Buffer>
+        T copyBuffer(const Napi::CallbackInfo &info, size_t index, const char *name)
+        {
+            auto buffer = requireBuffer(info, index, name);
+            return T(buffer.Data(), buffer.Length());
+        }
+
+        // View of a JS Buffer argument for a worker to read in place. The
+        // Buffer is added to the pinned list passed to the dispatcher.
+        ByteSpan borrowBuffer(const Napi::CallbackInfo &info, size_t index, const char *name,
+                              std::vector<Napi::Value> &pinned)
+        {
+            auto buffer = requireBuffer(info, index, name);
+            pinned.push_back(buffer);
+            return ByteSpan(buffer.Data(), buffer.Length());
+        }
+
+        // Views of a Buffer[] argument, each pinned as borrowBuffer does.
+        // Shared so that the worker lambda can hold the views.
+        std::shared_ptr<std::vector<ByteSpan>> borrowBufferArray(const Napi::CallbackInfo &info, size_t index,
+                                                                 const char *name, std::vector<Napi::Value> &pinned)
+        {
+            Napi::Env env = info.Env();
+            if (info.Length() <= index || !info[index].IsArray())
+            {
+                throw Napi::TypeError::New(env, std::string(name) + " must be an array of Buffers");
+            }
+            Napi::Array items = info[index].As<Napi::Array>();
+            if (items.Length() == 0)
+            {
+                throw Napi::RangeError::New(env, std::string(name) + " must not be empty");
+            }
+            auto spans = std::make_shared<std::vector<ByteSpan>>();
+            spans->reserve(items.Length());
+            pinned.reserve(pinned.size() + items.Length());
+            for (uint32_t i = 0; i < items.Length(); ++i)
+            {
+                Napi::Value item = items.Get(i);
+                if (!item.IsBuffer())
+                {
+                    throw Napi::TypeError::New(env, std::string(name) + " must be an array of Buffers");
+                }
+                auto buffer = item.As<Napi::Buffer<uint8_t>>();
+                pinned.push_back(buffer);
+                spans->emplace_back(buffer.Data(), buffer.Length());
+            }
+            return spans;
+        }
+
+        // Hand a native allocation to JS without copying; the Node Buffer
+        // owns it and releases it when collected (SecureBuffer zeroizes).
+        // V8 is told about the size so that large results drive GC.
+        template <typename Owner>
+        Napi::Buffer<uint8_t> toNodeBuffer(Napi::Env env, Owner owner)
+        {
+            auto *owned = new Owner(std::move(owner));
+            int64_t size = static_cast<int64_t>(owned->size());
+            Napi::MemoryManagement::AdjustExternalMemory(env, size);
+            return Napi::Buffer<uint8_t>::NewOrCopy(
+                env, owned->data(), owned->size(),
+                [size](Napi::Env env, uint8_t *, Owner *hint)
+                {
+                    delete hint;
+                    Napi::MemoryManagement::AdjustExternalMemory(env, -size);
+                },
+                owned);
+        }
+
+        Napi::Object keyPairToObject(Napi::Env env, KeyPair &keyPair)
+        {
+            Napi::Object result = Napi::Object::New(env);
+            result.Set("publicKey", toNodeBuffer(env, std::move(keyPair.publicKey)));
+            result.Set("privateKey", toNodeBuffer(env, std::move(keyPair.privateKey)));
+            return result;
+        }
+
+        // Parse info[0] as {message, signature, publicKey}[] into items that
+        // point at the caller's Buffers, which are added to `pinned`. A whole
+        // block is verified with a single native call and no copies.
+        std::shared_ptr<std::vector<VerifyItem>> parseVerifyBatch(const Napi::CallbackInfo &info,
+                                                                  std::vector<Napi::Value> &pinned)
+        {
+            Napi::Env env = info.Env();
+            if (info.Length() < 1 || !info[0].IsArray())
+            {
+                throw Napi::TypeError::New(env, "items must be an array");
+            }
+            Napi::Array items = info[0].As<Napi::Array>();
+            auto batch = std::make_shared<std::vector<VerifyItem>>();
+            batch->reserve(items.Length());
+            pinned.reserve(pinned.size() + items.Length() * 3);
+
+            static const char *const FIELDS[] = {"message", "signature", "publicKey"};
+            Napi::Buffer<uint8_t> fields[3];
+            for (uint32_t i = 0; i < items.Length(); ++i)
+            {
+                Napi::Value item = items.Get(i);
+                if (!item.IsObject())
+                {
+                    throw Napi::TypeError::New(env, "batch items must be objects");
+                }
+                for (size_t f = 0; f < 3; ++f)
+                {
+                    Napi::Value value = item.As<Napi::Object>().Get(FIELDS[f]);
+                    if (!value.IsBuffer())
+                    {
+                        throw Napi::TypeError::New(env, std::string("batch item ") + FIELDS[f] + " must be a Buffer");
+                    }
+                    fields[f] = value.As<Napi::Buffer<uint8_t>>();
+                    pinned.push_back(fields[f]);
+                }
+                batch->push_back(VerifyItem{
+                    fields[0].Data(), fields[0].Length(),
+                    fields[1].Data(), fields[1].Length(),
+                    fields[2].Data(), fields[2].Length()});
+            }
+            return batch;
+        }
+
+        // items: {message, ecdsaSignature, ecdsaPublicKey, signature, publicKey}[]
+        std::shared_ptr<std::vector<HybridVerifyItem>> parseHybridBatch(const Napi::CallbackInfo &info,
+                                                                        std::vector<Napi::Value> &pinned)
+        {
+            Napi::Env env = info.Env();
+            if (info.Length() < 1 || !info[0].IsArray())
+            {
+                throw Napi::TypeError::New(env, "items must be an array");
+            }
+            Napi::Array items = info[0].As<Napi::Array>();
+            auto batch = std::make_shared<std::vector<HybridVerifyItem>>();
+            batch->reserve(items.Length());
+            pinned.reserve(pinned.size() + items.Length() * 5);
+
+            static const char *const FIELDS[] = {"message", "ecdsaSignature", "ecdsaPublicKey", "signature",
+                                                 "publicKey"};
+            ByteSpan fields[5];
+            for (uint32_t i = 0; i < items.Length(); ++i)
+            {
+                Napi::Value item = items.Get(i);
+                if (!item.IsObject())
+                {
+                    throw Napi::TypeError::New(env, "batch items must be objects");
+                }
+                for (size_t f = 0; f < 5; ++f)
+                {
+                    Napi::Value value = item.As<Napi::Object>().Get(FIELDS[f]);
+                    if (!value.IsBuffer())
+                    {
+                        throw Napi::TypeError::New(env, std::string("batch item ") + FIELDS[f] + " must be a Buffer");
+                    }
+                    auto buffer = value.As<Napi::Buffer<uint8_t>>();
+                    pinned.push_back(buffer);
+                    fields[f] = ByteSpan(buffer.Data(), buffer.Length());
+                }
+                batch->push_back(HybridVerifyItem{fields[0], fields[1], fields[2], fields[3], fields[4]});
+            }
+            return batch;
+        }
+
+        Napi::Value batchResultToObject(Napi::Env env, BatchVerifyResult &result)
+        {
+            Napi::Object object = Napi::Object::New(env);
+            object.Set("bitmap", Napi::Buffer<uint8_t>::Copy(env, result.bitmap.data(), result.bitmap.size()));
+            object.Set("validCount", Napi::Number::New(env, static_cast<double>(result.validCount)));
+            object.Set("allValid", Napi::Boolean::New(env, result.allValid()));
+            object.Set("aborted", Napi::Boolean::New(env, result.aborted));
+            return object;
+        }
+
+        Napi::Value healthStatusToObject(Napi::Env env, const HealthStatus &status)
+        {
+            Napi::Object object = Napi::Object::New(env);
+            object.Set("failures", Napi::Number::New(env, status.failures));
+            object.Set("healthy", Napi::Boolean::New(env, status.failures == 0));
+            object.Set("pending", Napi::Boolean::New(env, (status.failures & HEALTH_PENDING) != 0));
+            object.Set("runs", Napi::Number::New(env, static_cast<double>(status.runs)));
+            object.Set("lastRunMillis", Napi::Number::New(env, static_cast<double>(status.lastRunMillis)));
+            object.Set("lastDurationMicros", Napi::Number::New(env, static_cast<double>(status.lastDurationMicros)));
+            return object;
+        }
+    }
+
+    class QuantumAddon : public Napi::Addon<QuantumAddon>
+    {
+    public:
+        QuantumAddon(Napi::Env env, Napi::Object exports)
+            : crypto_(QuantumCrypto::getInstance(cryptoParams(defaultWorkerThreads()))),
+              dispatcher_(env, defaultWorkerThreads())
+        {
+            DefineAddon(exports, {
+                                     InstanceMethod("generateDilithiumPair", &QuantumAddon::GenerateDilithiumPair),
+                                     InstanceMethod("kyberGenerateKeyPair", &QuantumAddon::KyberGenerateKeyPair),
+                                     InstanceMethod("generateKeyPairsBatch", &QuantumAddon::GenerateKeyPairsBatch),
+                                     InstanceMethod("dilithiumSign", &QuantumAddon::DilithiumSign),
+                                     InstanceMethod("loadPrivateKey", &QuantumAddon::LoadPrivateKey),
+                                     InstanceMethod("signWithHandle", &QuantumAddon::SignWithHandle),
+                                     InstanceMethod("unloadPrivateKey", &QuantumAddon::UnloadPrivateKey),
+                                     InstanceMethod("loadKyberPrivateKey", &QuantumAddon::LoadKyberPrivateKey),
+                                     InstanceMethod("kyberDecapsulateWithHandle", &QuantumAddon::KyberDecapsulateWithHandle),
+                                     InstanceMethod("kyberDecapsulateBatchWithHandle", &QuantumAddon::KyberDecapsulateBatchWithHandle),
+                                     InstanceMethod("prehashInit", &QuantumAddon::PrehashInit),
+                                     InstanceMethod("prehashUpdate", &QuantumAddon::PrehashUpdate),
+                                     InstanceMethod("prehashSign", &QuantumAddon::PrehashSign),
+                                     InstanceMethod("prehashVerify", &QuantumAddon::PrehashVerify),
+                                     InstanceMethod("dilithiumVerify", &QuantumAddon::DilithiumVerify),
+                                     InstanceMethod("dilithiumVerifyBatch", &QuantumAddon::DilithiumVerifyBatch),
+                                     InstanceMethod("verifyHybrid", &QuantumAddon::VerifyHybrid),
+                                     InstanceMethod("verifyHybridBatch", &QuantumAddon::VerifyHybridBatch),
+                                     InstanceMethod("generateFalconKeyPair", &QuantumAddon::GenerateFalconKeyPair),
+                                     InstanceMethod("falconSign", &QuantumAddon::FalconSign),
+                                     InstanceMethod("falconVerify", &QuantumAddon::FalconVerify),
+                                     InstanceMethod("falconVerifyBatch", &QuantumAddon::FalconVerifyBatch),
+                                     InstanceMethod("kyberEncapsulate", &QuantumAddon::KyberEncapsulate),
+                                     InstanceMethod("kyberDecapsulate", &QuantumAddon::KyberDecapsulate),
+                                     InstanceMethod("kyberEncapsulateBatch", &QuantumAddon::KyberEncapsulateBatch),
+                                     InstanceMethod("kyberDecapsulateBatch", &QuantumAddon::KyberDecapsulateBatch),
+                                     InstanceMethod("dilithiumHash", &QuantumAddon::DilithiumHash),
+                                     InstanceMethod("kyberHash", &QuantumAddon::KyberHash),
+                                     InstanceMethod("hash", &QuantumAddon::Hash),
+                                     InstanceMethod("hashBatch", &QuantumAddon::HashBatch),
+                                     InstanceMethod("getHashBackend", &QuantumAddon::GetHashBackend),
+                                     InstanceMethod("hybridHash", &QuantumAddon::HybridHashSync),
+                                     InstanceMethod("hybridHashBatch", &QuantumAddon::HybridHashBatch),
+                                     InstanceMethod("merkleBuild", &QuantumAddon::MerkleBuild),
+                                     InstanceMethod("merkleProof", &QuantumAddon::MerkleProofAt),
+                                     InstanceMethod("merkleVerifyProofs", &QuantumAddon::MerkleVerifyProofs),
+                                     InstanceMethod("mine", &QuantumAddon::Mine),
+                                     InstanceMethod("cancelMining", &QuantumAddon::CancelMining),
+                                     InstanceMethod("getMiningGeneration", &QuantumAddon::GetMiningGeneration),
+                                     InstanceMethod("setSecurityLevel", &QuantumAddon::SetSecurityLevel),
+                                     InstanceMethod("getSecurityLevel", &QuantumAddon::GetSecurityLevel),
+                                     InstanceMethod("getParameterSet", &QuantumAddon::GetParameterSet),
+                                     InstanceMethod("getSecureMemoryStats", &QuantumAddon::GetSecureMemoryStats),
+                                     InstanceMethod("randomBytes", &QuantumAddon::RandomBytes),
+                                     InstanceMethod("getEntropyStats", &QuantumAddon::GetEntropyStats),
+                                     InstanceMethod("getSecurityLogStats", &QuantumAddon::GetSecurityLogStats),
+                                     InstanceMethod("getOperationMetrics", &QuantumAddon::GetOperationMetrics),
+                                     InstanceMethod("getHealthStatus", &QuantumAddon::GetHealthStatus),
+                                     InstanceMethod("runHealthCheck", &QuantumAddon::RunHealthCheck),
+                                     InstanceMethod("getVerifyCacheStats", &QuantumAddon::GetVerifyCacheStats),
+                                     InstanceMethod("clearVerifyCache", &QuantumAddon::ClearVerifyCache),
+                                     InstanceMethod("preparePublicKey", &QuantumAddon::PreparePublicKey),
+                                     InstanceMethod("verifyPrepared", &QuantumAddon::VerifyPrepared),
+                                     InstanceMethod("verifyPreparedBatch", &QuantumAddon::VerifyPreparedBatch),
+                                     InstanceMethod("getPreparedKeyStats", &QuantumAddon::GetPreparedKeyStats),
+                                     InstanceMethod("setKeyPoolDepth", &QuantumAddon::SetKeyPoolDepth),
+                                     InstanceMethod("getKeyPoolStats", &QuantumAddon::GetKeyPoolStats),
+                                     InstanceMethod("setWorkerThreads", &QuantumAddon::SetWorkerThreads),
+                                     InstanceMethod("getWorkerThreads", &QuantumAddon::GetWorkerThreads),
+                                 });
+        }
+
+        ~QuantumAddon()
+        {
+            // Let a running search return so the dispatcher can join its workers.
+            cancelMiningJobs();
+        }
+
+    private:
+        Napi::Value GenerateDilithiumPair(const Napi::CallbackInfo &info)
+        {
+            // Caller-supplied entropy is mixed into the OpenSSL DRBG as
+            // additional input; it never replaces the system seed.
+            if (info.Length() > 0 && !info[0].IsUndefined())
+            {
+                auto entropy = requireBuffer(info, 0, "entropy");
+                RAND_add(entropy.Data(), static_cast<int>(entropy.Length()), 0.0);
+            }
+
+            SecurityLevel level = optionalLevel(info, 1, crypto_);
+
+            QuantumCrypto &crypto = crypto_;
+            return dispatcher_.run<KeyPair>(
+                info.Env(),
+                [&crypto, level]()
+                { return crypto.generateDilithiumKeyPair(level); },
+                [](Napi::Env env, KeyPair &keyPair) -> Napi::Value
+                { return keyPairToObject(env, keyPair); });
+        }
+
+        Napi::Value KyberGenerateKeyPair(const Napi::CallbackInfo &info)
+        {
+            SecurityLevel level = optionalLevel(info, 0, crypto_);
+
+            QuantumCrypto &crypto = crypto_;
+            return dispatcher_.run<KeyPair>(
+                info.Env(),
+                [&crypto, level]()
+                { return crypto.generateKyberKeyPair(level); },
+                [](Napi::Env env, KeyPair &keyPair) -> Napi::Value
+                { return keyPairToObject(env, keyPair); });
+        }
+
+        // generateKeyPairsBatch(algorithm, count, level?) where algorithm
+        // is 'dilithium' or 'kyber'. Resolves to the packed key material.
+        Napi::Value GenerateKeyPairsBatch(const Napi::CallbackInfo &info)
+        {
+            Napi::Env env = info.Env();
+            if (info.Length() < 1 || !info[0].IsString())
+            {
+                throw Napi::TypeError::New(env, "algorithm must be a string");
+            }
+            if (info.Length() < 2 || !info[1].IsNumber())
+            {
+                throw Napi::TypeError::New(env, "count must be a number");
+            }
+            std::string name = info[0].As<Napi::String>().Utf8Value();
+            KeyAlgorithm algorithm;
+            if (name == "dilithium")
+            {
+                algorithm = KeyAlgorithm::DILITHIUM;
+            }
+            else if (name == "kyber")
+            {
+                algorithm = KeyAlgorithm::KYBER;
+            }
+            else
+            {
+                throw Napi::RangeError::New(env, "algorithm must be 'dilithium' or 'kyber'");
+            }
+            size_t count = info[1].As<Napi::Number>().Uint32Value();
+            if (count == 0)
+            {
+                throw Napi::RangeError::New(env, "count must be positive");
+            }
+            SecurityLevel level = optionalLevel(info, 2, crypto_);
+
+            QuantumCrypto &crypto = crypto_;
+            return dispatcher_.run<KeyPairBatch>(
+                env,
+                [&crypto, algorithm, level, count]()
+                { return crypto.generateKeyPairsBatch(algorithm, level, count); },
+                [](Napi::Env env, KeyPairBatch &batch) -> Napi::Value
+                {
+                    Napi::Object result = Napi::Object::New(env);
+                    result.Set("count", Napi::Number::New(env, static_cast<double>(batch.count)));
+                    result.Set("publicKeyLength", Napi::Number::New(env, static_cast<double>(batch.publicKeyLength)));
+                    result.Set("privateKeyLength", Napi::Number::New(env, static_cast<double>(batch.privateKeyLength)));
+                    result.Set("publicKeys", toNodeBuffer(env, std::move(batch.publicKeys)));
+                    result.Set("privateKeys", toNodeBuffer(env, std::move(batch.privateKeys)));
+                    return result;
+                });
+        }
+
+        Napi::Value DilithiumSign(const Napi::CallbackInfo &info)
+        {
+            std::vector<Napi::Value> pinned;
+            ByteSpan message = borrowBuffer(info, 0, "message", pinned);
+            ByteSpan key = borrowBuffer(info, 1, "privateKey", pinned);
+            SecurityLevel level = optionalLevel(info, 2, crypto_);
+
+            QuantumCrypto &crypto = crypto_;
+            return dispatcher_.run<Signature>(
+                info.Env(),
+                [&crypto, level, message, key]()
+                { return crypto.sign(level, message, key); },
+                [](Napi::Env env, Signature &signature) -> Napi::Value
+                { return toNodeBuffer(env, std::move(signature)); },
+                pinned);
+        }
+
+        // Registry entries are exposed as tagged Externals rather than their
+        // ids, so a handle cannot be guessed or forged from a number, and the
+        // key is unloaded when JS drops the handle. Unloading twice is a
+        // no-op because ids are never reused.
+        Napi::Value privateKeyHandle(Napi::Env env, KeyRegistry::Handle id)
+        {
+            QuantumCrypto &crypto = crypto_;
+            auto external = Napi::External<KeyRegistry::Handle>::New(
+                env, new KeyRegistry::Handle(id), [&crypto](Napi::Env, KeyRegistry::Handle *owned)
+                {
+                    crypto.unloadPrivateKey(*owned);
+                    delete owned; });
+            external.TypeTag(&PRIVATE_KEY_TAG);
+            return external;
+        }
+
+        KeyRegistry::Handle requireHandle(const Napi::CallbackInfo &info, size_t index)
+        {
+            if (info.Length() <= index || !info[index].IsExternal() ||
+                !info[index].As<Napi::External<KeyRegistry::Handle>>().CheckTypeTag(&PRIVATE_KEY_TAG))
+            {
+                throw Napi::TypeError::New(info.Env(), "handle must come from loadPrivateKey or loadKyberPrivateKey");
+            }
+            return *info[index].As<Napi::External<KeyRegistry::Handle>>().Data();
+        }
+
+        // loadPrivateKey(privateKey, level?) copies the key into native secure
+        // memory once and returns a handle for signWithHandle.
+        Napi::Value LoadPrivateKey(const Napi::CallbackInfo &info)
+        {
+            Napi::Env env = info.Env();
+            SecurityLevel level = optionalLevel(info, 1, crypto_);
+            try
+            {
+                return privateKeyHandle(env, crypto_.loadPrivateKey(level, copyBuffer<PrivateKey>(info, 0, "privateKey")));
+            }
+            catch (const QuantumError &e)
+            {
+                throw Napi::RangeError::New(env, e.what());
+            }
+        }
+
+        Napi::Value SignWithHandle(const Napi::CallbackInfo &info)
+        {
+            KeyRegistry::Handle handle = requireHandle(info, 0);
+            if (info.Length() < 2 || !info[1].IsBuffer())
+            {
+                throw Napi::TypeError::New(info.Env(), "message must be a Buffer");
+            }
+            auto message = info[1].As<Napi::Buffer<uint8_t>>();
+            ByteSpan data(message.Data(), message.Length());
+
+            QuantumCrypto &crypto = crypto_;
+            return dispatcher_.run<Signature>(
+                info.Env(),
+                [&crypto, handle, data]()
+                { return crypto.signWithHandle(handle, data.data(), data.size()); },
+                [](Napi::Env env, Signature &signature) -> Napi::Value
+                { return toNodeBuffer(env, std::move(signature)); },
+                {info[0], message});
+        }
+
+        Napi::Value UnloadPrivateKey(const Napi::CallbackInfo &info)
+        {
+            return Napi::Boolean::New(info.Env(), crypto_.unloadPrivateKey(requireHandle(info, 0)));
+        }
+
+        // loadKyberPrivateKey(privateKey, level?) returns a handle for
+        // kyberDecapsulateWithHandle; unloadPrivateKey releases it.
+        Napi::Value LoadKyberPrivateKey(const Napi::CallbackInfo &info)
+        {
+            Napi::Env env = info.Env();
+            SecurityLevel level = optionalLevel(info, 1, crypto_);
+            try
+            {
+                return privateKeyHandle(env,
+                                        crypto_.loadKyberPrivateKey(level, copyBuffer<PrivateKey>(info, 0, "privateKey")));
+            }
+            catch (const QuantumError &e)
+            {
+                throw Napi::RangeError::New(env, e.what());
+            }
+        }
+
+        Napi::Value KyberDecapsulateWithHandle(const Napi::CallbackInfo &info)
+        {
+            KeyRegistry::Handle handle = requireHandle(info, 0);
+            // Pinned so the key is not collected and unloaded mid-call
+            std::vector<Napi::Value> pinned{info[0]};
+            ByteSpan ciphertext = borrowBuffer(info, 1, "ciphertext", pinned);
+
+            QuantumCrypto &crypto = crypto_;
+            return dispatcher_.run<SharedSecret>(
+                info.Env(),
+                [&crypto, handle, ciphertext]()
+                { return crypto.decapsulateWithHandle(handle, ciphertext); },
+                [](Napi::Env env, SharedSecret &secret) -> Napi::Value
+                { return toNodeBuffer(env, std::move(secret)); },
+                pinned);
+        }
+
+        // kyberDecapsulateBatchWithHandle(handle, ciphertexts: Buffer[])
+        // resolves to the shared secrets back to back in one Buffer.
+        Napi::Value KyberDecapsulateBatchWithHandle(const Napi::CallbackInfo &info)
+        {
+            KeyRegistry::Handle handle = requireHandle(info, 0);
+            std::vector<Napi::Value> pinned{info[0]};
+            auto ciphertexts = borrowBufferArray(info, 1, "ciphertexts", pinned);
+
+            QuantumCrypto &crypto = crypto_;
+            return dispatcher_.run<SharedSecret>(
+                info.Env(),
+                [&crypto, handle, ciphertexts]()
+                { return crypto.decapsulateBatchWithHandle(handle, ciphertexts->data(), ciphertexts->size()); },
+                [](Napi::Env env, SharedSecret &secrets) -> Napi::Value
+                { return toNodeBuffer(env, std::move(secrets)); },
+                pinned);
+        }
+
+        // State behind a prehashInit handle. Signing or verifying takes the
+        // Prehash out, so later calls on the handle fail cleanly.
+        struct PrehashHandle
+        {
+            std::shared_ptr<Prehash> state;
+        };
+
+        // Type tags keep one kind of External handle from being passed
+        // where another is expected
+        static constexpr napi_type_tag PREHASH_TAG = {0x6833746167707268ULL, 0x0000000000000001ULL};
+        static constexpr napi_type_tag PREPARED_KEY_TAG = {0x6833746167707268ULL, 0x0000000000000002ULL};
+        static constexpr napi_type_tag PRIVATE_KEY_TAG = {0x6833746167707268ULL, 0x0000000000000003ULL};
+
+        // prehashInit(kind, levelOrVariant?, context?) where kind is
+        // 'dilithium' or 'falcon'. Returns a handle for prehashUpdate.
+        Napi::Value PrehashInit(const Napi::CallbackInfo &info)
+        {
+            Napi::Env env = info.Env();
+            if (info.Length() < 1 || !info[0].IsString())
+            {
+                throw Napi::TypeError::New(env, "kind must be a string");
+            }
+            ByteSpan context;
+            if (info.Length() > 2 && !info[2].IsUndefined())
+            {
+                if (!info[2].IsBuffer())
+                {
+                    throw Napi::TypeError::New(env, "context must be a Buffer");
+                }
+                auto buffer = info[2].As<Napi::Buffer<uint8_t>>();
+                context = ByteSpan(buffer.Data(), buffer.Length());
+            }
+
+            std::string kind = info[0].As<Napi::String>().Utf8Value();
+            auto handle = std::make_unique<PrehashHandle>();
+            try
+            {
+                if (kind == "dilithium")
+                {
+                    handle->state = std::make_shared<Prehash>(crypto_.beginPrehash(optionalLevel(info, 1, crypto_), context));
+                }
+                else if (kind == "falcon")
+                {
+                    handle->state = std::make_shared<Prehash>(crypto_.beginFalconPrehash(optionalFalconVariant(info, 1), context));
+                }
+                else
+                {
+                    throw Napi::RangeError::New(env, "kind must be 'dilithium' or 'falcon'");
+                }
+            }
+            catch (const QuantumError &e)
+            {
+                throw Napi::RangeError::New(env, e.what());
+            }
+            auto external = Napi::External<PrehashHandle>::New(env, handle.release(), [](Napi::Env, PrehashHandle *owned)
+                                                               { delete owned; });
+            external.TypeTag(&PREHASH_TAG);
+            return external;
+        }
+
+        PrehashHandle &requirePrehash(const Napi::CallbackInfo &info)
+        {
+            if (info.Length() < 1 || !info[0].IsExternal() ||
+                !info[0].As<Napi::External<PrehashHandle>>().CheckTypeTag(&PREHASH_TAG))
+            {
+                throw Napi::TypeError::New(info.Env(), "handle must come from prehashInit");
+            }
+            return *info[0].As<Napi::External<PrehashHandle>>().Data();
+        }
+
+        std::shared_ptr<Prehash> takePrehash(const Napi::CallbackInfo &info)
+        {
+            std::shared_ptr<Prehash> state = std::move(requirePrehash(info).state);
+            if (!state)
+            {
+                throw Napi::Error::New(info.Env(), "Pre-hash already finished");
+            }
+            return state;
+        }
+
+        // prehashUpdate(handle, data). Runs on the JS thread, so feed large
+        // payloads in chunks as they are produced.
+        Napi::Value PrehashUpdate(const Napi::CallbackInfo &info)
+        {
+            Napi::Env env = info.Env();
+            PrehashHandle &handle = requirePrehash(info);
+            if (info.Length() < 2 || !info[1].IsBuffer())
+            {
+                throw Napi::TypeError::New(env, "data must be a Buffer");
+            }
+            if (!handle.state)
+            {
+                throw Napi::Error::New(env, "Pre-hash already finished");
+            }
+            auto data = info[1].As<Napi::Buffer<uint8_t>>();
+            handle.state->update(data.Data(), data.Length());
+            return env.Undefined();
+        }
+
+        Napi::Value PrehashSign(const Napi::CallbackInfo &info)
+        {
+            std::vector<Napi::Value> pinned;
+            ByteSpan key = borrowBuffer(info, 1, "privateKey", pinned);
+            std::shared_ptr<Prehash> state = takePrehash(info);
+
+            QuantumCrypto &crypto = crypto_;
+            return dispatcher_.run<Signature>(
+                info.Env(),
+                [&crypto, state, key]()
+                { return crypto.signPrehashed(*state, key); },
+                [](Napi::Env env, Signature &signature) -> Napi::Value
+                { return toNodeBuffer(env, std::move(signature)); },
+                pinned);
+        }
+
+        Napi::Value PrehashVerify(const Napi::CallbackInfo &info)
+        {
+            std::vector<Napi::Value> pinned;
+            ByteSpan signature = borrowBuffer(info, 1, "signature", pinned);
+            ByteSpan key = borrowBuffer(info, 2, "publicKey", pinned);
+            std::shared_ptr<Prehash> state = takePrehash(info);
+
+            QuantumCrypto &crypto = crypto_;
+            return dispatcher_.run<bool>(
+                info.Env(),
+                [&crypto, state, signature, key]()
+                { return crypto.verifyPrehashed(*state, signature, key); },
+                [](Napi::Env env, bool &valid) -> Napi::Value
+                { return Napi::Boolean::New(env, valid); },
+                pinned);
+        }
+
+        Napi::Value DilithiumVerify(const Napi::CallbackInfo &info)
+        {
+            std::vector<Napi::Value> pinned;
+            ByteSpan message = borrowBuffer(info, 0, "message", pinned);
+            ByteSpan signature = borrowBuffer(info, 1, "signature", pinned);
+            ByteSpan key = borrowBuffer(info, 2, "publicKey", pinned);
+            SecurityLevel level = optionalLevel(info, 3, crypto_);
+
+            QuantumCrypto &crypto = crypto_;
+            return dispatcher_.run<bool>(
+                info.Env(),
+                [&crypto, level, message, signature, key]()
+                { return crypto.verify(level, message, signature, key); },
+                [](Napi::Env env, bool &valid) -> Napi::Value
+                { return Napi::Boolean::New(env, valid); },
+                pinned);
+        }
+
+        // dilithiumVerifyBatch(items: {message, signature, publicKey}[], earlyAbort?, level?)
+        Napi::Value DilithiumVerifyBatch(const Napi::CallbackInfo &info)
+        {
+            std::vector<Napi::Value> pinned;
+            auto batch = parseVerifyBatch(info, pinned);
+            bool earlyAbort = info.Length() > 1 && info[1].ToBoolean().Value();
+            SecurityLevel level = optionalLevel(info, 2, crypto_);
+
+            QuantumCrypto &crypto = crypto_;
+            return dispatcher_.run<BatchVerifyResult>(
+                info.Env(),
+                [&crypto, level, batch, earlyAbort]()
+                { return crypto.verifyBatch(level, batch->data(), batch->size(), earlyAbort); },
+                batchResultToObject, pinned);
+        }
+
+        // verifyHybrid(message, ecdsaSignature, ecdsaPublicKey, signature,
+        // publicKey, level?): secp256k1 ECDSA over SHA-256(message) and
+        // Dilithium over message, checked concurrently
+        Napi::Value VerifyHybrid(const Napi::CallbackInfo &info)
+        {
+            std::vector<Napi::Value> pinned;
+            HybridVerifyItem item{
+                borrowBuffer(info, 0, "message", pinned),
+                borrowBuffer(info, 1, "ecdsaSignature", pinned),
+                borrowBuffer(info, 2, "ecdsaPublicKey", pinned),
+                borrowBuffer(info, 3, "signature", pinned),
+                borrowBuffer(info, 4, "publicKey", pinned)};
+            SecurityLevel level = optionalLevel(info, 5, crypto_);
+
+            QuantumCrypto &crypto = crypto_;
+            return dispatcher_.run<bool>(
+                info.Env(),
+                [&crypto, level, item]()
+                { return crypto.verifyHybrid(level, item); },
+                [](Napi::Env env, bool &valid) -> Napi::Value
+                { return Napi::Boolean::New(env, valid); },
+                pinned);
+        }
+
+        // verifyHybridBatch(items, earlyAbort?, level?)
+        Napi::Value VerifyHybridBatch(const Napi::CallbackInfo &info)
+        {
+            std::vector<Napi::Value> pinned;
+            auto batch = parseHybridBatch(info, pinned);
+            bool earlyAbort = info.Length() > 1 && info[1].ToBoolean().Value();
+            SecurityLevel level = optionalLevel(info, 2, crypto_);
+
+            QuantumCrypto &crypto = crypto_;
+            return dispatcher_.run<BatchVerifyResult>(
+                info.Env(),
+                [&crypto, level, batch, earlyAbort]()
+                { return crypto.verifyHybridBatch(level, batch->data(), batch->size(), earlyAbort); },
+                batchResultToObject, pinned);
+        }
+
+        Napi::Value GenerateFalconKeyPair(const Napi::CallbackInfo &info)
+        {
+            FalconVariant variant = optionalFalconVariant(info, 0);
+
+            QuantumCrypto &crypto = crypto_;
+            return dispatcher_.run<KeyPair>(
+                info.Env(),
+                [&crypto, variant]()
+                { return crypto.generateFalconKeyPair(variant); },
+                [](Napi::Env env, KeyPair &keyPair) -> Napi::Value
+                { return keyPairToObject(env, keyPair); });
+        }
+
+        Napi::Value FalconSign(const Napi::CallbackInfo &info)
+        {
+            std::vector<Napi::Value> pinned;
+            ByteSpan message = borrowBuffer(info, 0, "message", pinned);
+            ByteSpan key = borrowBuffer(info, 1, "privateKey", pinned);
+            FalconVariant variant = optionalFalconVariant(info, 2);
+
+            QuantumCrypto &crypto = crypto_;
+            return dispatcher_.run<Signature>(
+                info.Env(),
+                [&crypto, variant, message, key]()
+                { return crypto.falconSign(variant, message, key); },
+                [](Napi::Env env, Signature &signature) -> Napi::Value
+                { return toNodeBuffer(env, std::move(signature)); },
+                pinned);
+        }
+
+        Napi::Value FalconVerify(const Napi::CallbackInfo &info)
+        {
+            std::vector<Napi::Value> pinned;
+            ByteSpan message = borrowBuffer(info, 0, "message", pinned);
+            ByteSpan signature = borrowBuffer(info, 1, "signature", pinned);
+            ByteSpan key = borrowBuffer(info, 2, "publicKey", pinned);
+            FalconVariant variant = optionalFalconVariant(info, 3);
+
+            QuantumCrypto &crypto = crypto_;
+            return dispatcher_.run<bool>(
+                info.Env(),
+                [&crypto, variant, message, signature, key]()
+                { return crypto.falconVerify(variant, message, signature, key); },
+                [](Napi::Env env, bool &valid) -> Napi::Value
+                { return Napi::Boolean::New(env, valid); },
+                pinned);
+        }
+
+        // falconVerifyBatch(items: {message, signature, publicKey}[], earlyAbort?, variant?)
+        Napi::Value FalconVerifyBatch(const Napi::CallbackInfo &info)
+        {
+            std::vector<Napi::Value> pinned;
+            auto batch = parseVerifyBatch(info, pinned);
+            bool earlyAbort = info.Length() > 1 && info[1].ToBoolean().Value();
+            FalconVariant variant = optionalFalconVariant(info, 2);
+
+            QuantumCrypto &crypto = crypto_;
+            return dispatcher_.run<BatchVerifyResult>(
+                info.Env(),
+                [&crypto, variant, batch, earlyAbort]()
+                { return crypto.falconVerifyBatch(variant, batch->data(), batch->size(), earlyAbort); },
+                batchResultToObject, pinned);
+        }
+
+        Napi::Value KyberEncapsulate(const Napi::CallbackInfo &info)
+        {
+            std::vector<Napi::Value> pinned;
+            ByteSpan key = borrowBuffer(info, 0, "publicKey", pinned);
+            SecurityLevel level = optionalLevel(info, 1, crypto_);
+
+            QuantumCrypto &crypto = crypto_;
+            return dispatcher_.run<KyberResult>(
+                info.Env(),
+                [&crypto, level, key]()
+                { return crypto.kyberEncapsulate(level, key); },
+                [](Napi::Env env, KyberResult &result) -> Napi::Value
+                {
+                    Napi::Object object = Napi::Object::New(env);
+                    object.Set("ciphertext", toNodeBuffer(env, std::move(result.ciphertext)));
+                    object.Set("sharedSecret", toNodeBuffer(env, std::move(result.sharedSecret)));
+                    return object;
+                },
+                pinned);
+        }
+
+        Napi::Value KyberDecapsulate(const Napi::CallbackInfo &info)
+        {
+            std::vector<Napi::Value> pinned;
+            ByteSpan ciphertext = borrowBuffer(info, 0, "ciphertext", pinned);
+            ByteSpan key = borrowBuffer(info, 1, "privateKey", pinned);
+            SecurityLevel level = optionalLevel(info, 2, crypto_);
+
+            QuantumCrypto &crypto = crypto_;
+            return dispatcher_.run<SharedSecret>(
+                info.Env(),
+                [&crypto, level, ciphertext, key]()
+                { return crypto.kyberDecapsulate(level, ciphertext, key); },
+                [](Napi::Env env, SharedSecret &secret) -> Napi::Value
+                { return toNodeBuffer(env, std::move(secret)); },
+                pinned);
+        }
+
+        // kyberEncapsulateBatch(publicKeys: Buffer[], level?) resolves to the
+        // ciphertexts and shared secrets, each packed into one Buffer.
+        Napi::Value KyberEncapsulateBatch(const Napi::CallbackInfo &info)
+        {
+            std::vector<Napi::Value> pinned;
+            auto keys = borrowBufferArray(info, 0, "publicKeys", pinned);
+            SecurityLevel level = optionalLevel(info, 1, crypto_);
+
+            QuantumCrypto &crypto = crypto_;
+            return dispatcher_.run<KyberBatch>(
+                info.Env(),
+                [&crypto, level, keys]()
+                { return crypto.kyberEncapsulateBatch(level, keys->data(), keys->size()); },
+                [](Napi::Env env, KyberBatch &batch) -> Napi::Value
+                {
+                    Napi::Object result = Napi::Object::New(env);
+                    result.Set("count", Napi::Number::New(env, static_cast<double>(batch.count)));
+                    result.Set("ciphertextLength", Napi::Number::New(env, static_cast<double>(batch.ciphertextLength)));
+                    result.Set("sharedSecretLength", Napi::Number::New(env, static_cast<double>(batch.sharedSecretLength)));
+                    result.Set("ciphertexts", toNodeBuffer(env, std::move(batch.ciphertexts)));
+                    result.Set("sharedSecrets", toNodeBuffer(env, std::move(batch.sharedSecrets)));
+                    return result;
+                },
+                pinned);
+        }
+
+        // kyberDecapsulateBatch(ciphertexts: Buffer[], privateKey, level?)
+        // resolves to the shared secrets back to back in one Buffer.
+        Napi::Value KyberDecapsulateBatch(const Napi::CallbackInfo &info)
+        {
+            std::vector<Napi::Value> pinned;
+            auto ciphertexts = borrowBufferArray(info, 0, "ciphertexts", pinned);
+            ByteSpan key = borrowBuffer(info, 1, "privateKey", pinned);
+            SecurityLevel level = optionalLevel(info, 2, crypto_);
+
+            QuantumCrypto &crypto = crypto_;
+            return dispatcher_.run<SharedSecret>(
+                info.Env(),
+                [&crypto, level, ciphertexts, key]()
+                { return crypto.kyberDecapsulateBatch(level, ciphertexts->data(), ciphertexts->size(), key); },
+                [](Napi::Env env, SharedSecret &secrets) -> Napi::Value
+                { return toNodeBuffer(env, std::move(secrets)); },
+                pinned);
+        }
+
+        Napi::Value HashWith(const Napi::CallbackInfo &info, HashAlgorithm algorithm)
+        {
+            std::vector<Napi::Value> pinned;
+            ByteSpan data = borrowBuffer(info, 0, "data", pinned);
+            return dispatcher_.run<Buffer>(
+                info.Env(),
+                [data, algorithm]()
+                {
+                    Buffer hash(HashEngine::digestSize(algorithm));
+                    HashEngine::hash(algorithm, data.data(), data.size(), hash.data(), hash.size());
+                    return hash;
+                },
+                [](Napi::Env env, Buffer &hash) -> Napi::Value
+                { return toNodeBuffer(env, std::move(hash)); },
+                pinned);
+        }
+
+        // Dilithium's internal XOF
+        Napi::Value DilithiumHash(const Napi::CallbackInfo &info)
+        {
+            return HashWith(info, HashAlgorithm::SHAKE256);
+        }
+
+        // Kyber's internal hash
+        Napi::Value KyberHash(const Napi::CallbackInfo &info)
+        {
+            return HashWith(info, HashAlgorithm::SHA3_256);
+        }
+
+        Napi::Value Hash(const Napi::CallbackInfo &info)
+        {
+            return HashWith(info, HashAlgorithm::SHA3_512);
+        }
+
+        // Longest SHAKE digest and largest concatenated result hashBatch
+        // will allocate.
+        static constexpr size_t MAX_XOF_OUTPUT = size_t(1) << 16;
+        static constexpr size_t MAX_HASH_BATCH_BYTES = size_t(1) << 28;
+
+        // hashBatch(algorithm, items: Buffer[], outputLength?) resolves to the
+        // digests concatenated into one Buffer. Keccak-family batches are
+        // hashed several messages per SIMD pass.
+        Napi::Value HashBatch(const Napi::CallbackInfo &info)
+        {
+            Napi::Env env = info.Env();
+            if (info.Length() < 2 || !info[0].IsString() || !info[1].IsArray())
+            {
+                throw Napi::TypeError::New(env, "expected (algorithm: string, items: Buffer[])");
+            }
+
+            HashAlgorithm algorithm;
+            try
+            {
+                algorithm = HashEngine::parse(info[0].As<Napi::String>().Utf8Value());
+            }
+            catch (const std::exception &e)
+            {
+                throw Napi::RangeError::New(env, e.what());
+            }
+            size_t outputLength = HashEngine::digestSize(algorithm);
+            if (info.Length() > 2 && !info[2].IsUndefined())
+            {
+                // Validated here: the worker allocates items * outputLength
+                // before the engine sees the length.
+                double requested = info[2].IsNumber() ? info[2].As<Napi::Number>().DoubleValue() : 0;
+                bool xof = algorithm == HashAlgorithm::SHAKE128 || algorithm == HashAlgorithm::SHAKE256;
+                if (xof ? !(requested >= 1 && requested <= MAX_XOF_OUTPUT) || requested != std::floor(requested)
+                        : requested != static_cast<double>(outputLength))
+                {
+                    throw Napi::RangeError::New(
+                        env, xof ? "outputLength must be an integer between 1 and " + std::to_string(MAX_XOF_OUTPUT)
+                                 : "outputLength must equal the digest size of " + info[0].As<Napi::String>().Utf8Value());
+                }
+                outputLength = static_cast<size_t>(requested);
+            }
+
+            struct Batch
+            {
+                std::vector<const uint8_t *> data;
+                std::vector<size_t> lengths;
+            };
+            auto batch = std::make_shared<Batch>();
+
+            Napi::Array items = info[1].As<Napi::Array>();
+            if (items.Length() > MAX_HASH_BATCH_BYTES / outputLength)
+            {
+                throw Napi::RangeError::New(env, "hash batch output would exceed " +
+                                                     std::to_string(MAX_HASH_BATCH_BYTES) + " bytes");
+            }
+            std::vector<Napi::Value> pinned;
+            pinned.reserve(items.Length());
+            batch->data.reserve(items.Length());
+            batch->lengths.reserve(items.Length());
+            for (uint32_t i = 0; i < items.Length(); ++i)
+            {
+                Napi::Value item = items.Get(i);
+                if (!item.IsBuffer())
+                {
+                    throw Napi::TypeError::New(env, "batch items must be Buffers");
+                }
+                auto buffer = item.As<Napi::Buffer<uint8_t>>();
+                pinned.push_back(buffer);
+                batch->data.push_back(buffer.Data());
+                batch->lengths.push_back(buffer.Length());
+            }
+
+            return dispatcher_.run<std::vector<uint8_t>>(
+                env,
+                [batch, algorithm, outputLength]()
+                {
+                    std::vector<uint8_t> digests(batch->lengths.size() * outputLength);
+                    HashEngine::hashBatch(algorithm, batch->data.data(), batch->lengths.data(),
+                                          batch->lengths.size(), digests.data(), outputLength);
+                    return digests;
+                },
+                [](Napi::Env env, std::vector<uint8_t> &digests) -> Napi::Value
+                { return toNodeBuffer(env, std::move(digests)); },
+                pinned);
+        }
+
+        Napi::Value GetHashBackend(const Napi::CallbackInfo &info)
+        {
+            return Napi::String::New(info.Env(), HashEngine::backend());
+        }
+
+        // Synchronous: a single hybrid hash costs a few microseconds, well
+        // below the price of a round trip through the worker pool.
+        Napi::Value HybridHashSync(const Napi::CallbackInfo &info)
+        {
+            Napi::Env env = info.Env();
+            if (info.Length() < 1 || !info[0].IsBuffer())
+            {
+                throw Napi::TypeError::New(env, "data must be a Buffer");
+            }
+            auto data = info[0].As<Napi::Buffer<uint8_t>>();
+            auto digest = Napi::Buffer<uint8_t>::New(env, HybridHash::DIGEST_SIZE);
+            HybridHash::hash(data.Data(), data.Length(), digest.Data());
+            return digest;
+        }
+
+        // hybridHashBatch(items: Buffer[]) returns the digests concatenated
+        // into one Buffer of items.length * 64 bytes.
+        Napi::Value HybridHashBatch(const Napi::CallbackInfo &info)
+        {
+            Napi::Env env = info.Env();
+            if (info.Length() < 1 || !info[0].IsArray())
+            {
+                throw Napi::TypeError::New(env, "items must be an array");
+            }
+            Napi::Array items = info[0].As<Napi::Array>();
+            uint32_t count = items.Length();
+
+            std::vector<const uint8_t *> data(count);
+            std::vector<size_t> lengths(count);
+            for (uint32_t i = 0; i < count; ++i)
+            {
+                Napi::Value item = items.Get(i);
+                if (!item.IsBuffer())
+                {
+                    throw Napi::TypeError::New(env, "batch items must be Buffers");
+                }
+                auto buffer = item.As<Napi::Buffer<uint8_t>>();
+                data[i] = buffer.Data();
+                lengths[i] = buffer.Length();
+            }
+
+            auto digests = Napi::Buffer<uint8_t>::New(env, static_cast<size_t>(count) * HybridHash::DIGEST_SIZE);
+            HybridHash::hashBatch(data.data(), lengths.data(), count, digests.Data());
+            return digests;
+        }
+
+        // merkleBuild(leaves, prehashed?) hashes the leaves (unless they are
+        // already 32-byte leaf hashes) and builds every layer on the worker
+        // pool. Resolves with the root and the flat node layout that
+        // merkleProof reads proofs from.
+        Napi::Value MerkleBuild(const Napi::CallbackInfo &info)
+        {
+            Napi::Env env = info.Env();
+            if (info.Length() < 1 || !info[0].IsArray())
+            {
+                throw Napi::TypeError::New(env, "leaves must be an array");
+            }
+            bool prehashed = info.Length() > 1 && info[1].ToBoolean().Value();
+            Napi::Array items = info[0].As<Napi::Array>();
+            uint32_t count = items.Length();
+            if (count == 0)
+            {
+                throw Napi::RangeError::New(env, "Merkle tree needs at least one leaf");
+            }
+
+            // Leaf data is read in place; only prehashed leaves are gathered,
+            // since build() takes them as one contiguous array
+            struct Leaves
+            {
+                std::vector<uint8_t> hashes;
+                std::vector<const uint8_t *> data;
+                std::vector<size_t> lengths;
+            };
+            auto leaves = std::make_shared<Leaves>();
+            std::vector<Napi::Value> pinned;
+            if (prehashed)
+            {
+                leaves->hashes.reserve(static_cast<size_t>(count) * MerkleTree::NODE_SIZE);
+            }
+            else
+            {
+                pinned.reserve(count);
+                leaves->data.reserve(count);
+                leaves->lengths.reserve(count);
+            }
+            for (uint32_t i = 0; i < count; ++i)
+            {
+                Napi::Value item = items.Get(i);
+                if (!item.IsBuffer())
+                {
+                    throw Napi::TypeError::New(env, "leaves must be Buffers");
+                }
+                auto buffer = item.As<Napi::Buffer<uint8_t>>();
+                if (prehashed && buffer.Length() != MerkleTree::NODE_SIZE)
+                {
+                    throw Napi::RangeError::New(env, "prehashed leaves must be 32 bytes");
+                }
+                if (prehashed)
+                {
+                    leaves->hashes.insert(leaves->hashes.end(), buffer.Data(), buffer.Data() + buffer.Length());
+                    continue;
+                }
+                pinned.push_back(buffer);
+                leaves->data.push_back(buffer.Data());
+                leaves->lengths.push_back(buffer.Length());
+            }
+
+            QuantumCrypto &crypto = crypto_;
+            return dispatcher_.run<MerkleTree>(
+                env,
+                [leaves, prehashed, count, &crypto]()
+                {
+                    ThreadPool *pool = crypto.workerPool();
+                    if (!prehashed)
+                    {
+                        leaves->hashes.resize(static_cast<size_t>(count) * MerkleTree::NODE_SIZE);
+                        MerkleTree::hashLeaves(leaves->data.data(), leaves->lengths.data(), count,
+                                               leaves->hashes.data(), pool);
+                    }
+                    return MerkleTree::build(leaves->hashes.data(), count, pool);
+                },
+                [](Napi::Env env, MerkleTree &tree) -> Napi::Value
+                {
+                    Napi::Object result = Napi::Object::New(env);
+                    result.Set("root", Napi::Buffer<uint8_t>::Copy(env, tree.root(), MerkleTree::NODE_SIZE));
+                    result.Set("nodes", Napi::Buffer<uint8_t>::Copy(env, tree.nodes().data(), tree.nodes().size()));
+                    result.Set("leafCount", Napi::Number::New(env, static_cast<double>(tree.leafCount())));
+                    return result;
+                },
+                pinned);
+        }
+
+        // merkleProof(nodes, leafCount, index) -> { index, leaf, siblings }
+        Napi::Value MerkleProofAt(const Napi::CallbackInfo &info)
+        {
+            Napi::Env env = info.Env();
+            if (info.Length() < 3 || !info[0].IsBuffer() || !info[1].IsNumber() || !info[2].IsNumber())
+            {
+                throw Napi::TypeError::New(env, "expected (nodes: Buffer, leafCount: number, index: number)");
+            }
+            auto nodes = info[0].As<Napi::Buffer<uint8_t>>();
+            size_t leafCount = info[1].As<Napi::Number>().Uint32Value();
+            size_t index = info[2].As<Napi::Number>().Uint32Value();
+
+            if (leafCount == 0 || nodes.Length() != MerkleTree::nodeCount(leafCount) * MerkleTree::NODE_SIZE)
+            {
+                throw Napi::RangeError::New(env, "Merkle node layout does not match leaf count");
+            }
+
+            MerkleProof proof;
+            try
+            {
+                proof = MerkleTree::proof(nodes.Data(), leafCount, index);
+            }
+            catch (const std::exception &e)
+            {
+                throw Napi::RangeError::New(env, e.what());
+            }
+
+            Napi::Array siblings = Napi::Array::New(env, proof.siblings.size() / MerkleTree::NODE_SIZE);
+            for (uint32_t i = 0; i < siblings.Length(); ++i)
+            {
+                siblings.Set(i, Napi::Buffer<uint8_t>::Copy(env, proof.siblings.data() + i * MerkleTree::NODE_SIZE,
+                                                            MerkleTree::NODE_SIZE));
+            }
+            Napi::Object result = Napi::Object::New(env);
+            result.Set("index", Napi::Number::New(env, static_cast<double>(proof.index)));
+            result.Set("leaf", Napi::Buffer<uint8_t>::Copy(env, proof.leaf, MerkleTree::NODE_SIZE));
+            result.Set("siblings", siblings);
+            return result;
+        }
+
+        // merkleVerifyProofs(root, proofs[{ index, leaf, siblings }]) resolves
+        // with one boolean per proof.
+        Napi::Value MerkleVerifyProofs(const Napi::CallbackInfo &info)
+        {
+            Napi::Env env = info.Env();
+            if (info.Length() < 2 || !info[0].IsBuffer() || !info[1].IsArray())
+            {
+                throw Napi::TypeError::New(env, "expected (root: Buffer, proofs: MerkleProof[])");
+            }
+            auto rootBuffer = info[0].As<Napi::Buffer<uint8_t>>();
+            if (rootBuffer.Length() != MerkleTree::NODE_SIZE)
+            {
+                throw Napi::RangeError::New(env, "root must be 32 bytes");
+            }
+
+            struct Batch
+            {
+                uint8_t root[MerkleTree::NODE_SIZE];
+                std::vector<MerkleProof> proofs;
+            };
+            auto batch = std::make_shared<Batch>();
+            std::copy(rootBuffer.Data(), rootBuffer.Data() + MerkleTree::NODE_SIZE, batch->root);
+
+            Napi::Array items = info[1].As<Napi::Array>();
+            batch->proofs.resize(items.Length());
+            for (uint32_t i = 0; i < items.Length(); ++i)
+            {
+                Napi::Value value = items.Get(i);
+                if (!value.IsObject())
+                {
+                    throw Napi::TypeError::New(env, "proofs must be objects");
+                }
+                Napi::Object item = value.As<Napi::Object>();
+                Napi::Value index = item.Get("index");
+                Napi::Value leaf = item.Get("leaf");
+                Napi::Value siblings = item.Get("siblings");
+                if (!index.IsNumber() || !leaf.IsBuffer() || !siblings.IsArray())
+                {
+                    throw Napi::TypeError::New(env, "proof must be { index: number, leaf: Buffer, siblings: Buffer[] }");
+                }
+                auto leafBuffer = leaf.As<Napi::Buffer<uint8_t>>();
+                if (leafBuffer.Length() != MerkleTree::NODE_SIZE)
+                {
+                    throw Napi::RangeError::New(env, "proof leaf must be 32 bytes");
+                }
+
+                MerkleProof &proof = batch->proofs[i];
+                proof.index = index.As<Napi::Number>().Uint32Value();
+                std::copy(leafBuffer.Data(), leafBuffer.Data() + MerkleTree::NODE_SIZE, proof.leaf);
+                Napi::Array path = siblings.As<Napi::Array>();
+                for (uint32_t j = 0; j < path.Length(); ++j)
+                {
+                    Napi::Value sibling = path.Get(j);
+                    if (!sibling.IsBuffer() || sibling.As<Napi::Buffer<uint8_t>>().Length() != MerkleTree::NODE_SIZE)
+                    {
+                        throw Napi::RangeError::New(env, "proof siblings must be 32-byte Buffers");
+                    }
+                    auto node = sibling.As<Napi::Buffer<uint8_t>>();
+                    proof.siblings.insert(proof.siblings.end(), node.Data(), node.Data() + MerkleTree::NODE_SIZE);
+                }
+            }
+
+            QuantumCrypto &crypto = crypto_;
+            return dispatcher_.run<std::vector<uint8_t>>(
+                env,
+                [batch, &crypto]()
+                {
+                    return MerkleTree::verifyBatch(batch->proofs.data(), batch->proofs.size(), batch->root,
+                                                   crypto.workerPool());
+                },
+                [](Napi::Env env, std::vector<uint8_t> &valid) -> Napi::Value
+                {
+                    Napi::Array result = Napi::Array::New(env, valid.size());
+                    for (uint32_t i = 0; i < valid.size(); ++i)
+                    {
+                        result.Set(i, Napi::Boolean::New(env, valid[i] != 0));
+                    }
+                    return result;
+                });
+        }
+
+        // mine({ headerBase, start, end, target, threads? }) searches
+        // [start, end) for SHA3-256(headerBase || decimal(nonce)) <= target
+        // and resolves with the winning nonce and hash, if any.
+        Napi::Value Mine(const Napi::CallbackInfo &info)
+        {
+            Napi::Env env = info.Env();
+            if (info.Length() < 1 || !info[0].IsObject())
+            {
+                throw Napi::TypeError::New(env, "mining options must be an object");
+            }
+            Napi::Object options = info[0].As<Napi::Object>();
+
+            auto job = std::make_shared<MiningJob>();
+            Napi::Value header = options.Get("headerBase");
+            if (header.IsBuffer())
+            {
+                auto buffer = header.As<Napi::Buffer<uint8_t>>();
+                job->headerPrefix.assign(buffer.Data(), buffer.Data() + buffer.Length());
+            }
+            else if (header.IsString())
+            {
+                std::string text = header.As<Napi::String>().Utf8Value();
+                job->headerPrefix.assign(text.begin(), text.end());
+            }
+            else
+            {
+                throw Napi::TypeError::New(env, "headerBase must be a string or Buffer");
+            }
+
+            Napi::Value start = options.Get("start");
+            Napi::Value end = options.Get("end");
+            if (!start.IsNumber() || !end.IsNumber())
+            {
+                throw Napi::TypeError::New(env, "start and end must be numbers");
+            }
+            double startNonce = start.As<Napi::Number>().DoubleValue();
+            double endNonce = end.As<Napi::Number>().DoubleValue();
+            if (startNonce < 0 || endNonce <= startNonce || endNonce > 9007199254740991.0)
+            {
+                throw Napi::RangeError::New(env, "Invalid nonce range");
+            }
+            job->startNonce = static_cast<uint64_t>(startNonce);
+            job->endNonce = static_cast<uint64_t>(endNonce);
+
+            Napi::Value target = options.Get("target");
+            if (!target.IsBuffer() || target.As<Napi::Buffer<uint8_t>>().Length() != sizeof(job->target))
+            {
+                throw Napi::TypeError::New(env, "target must be a 32-byte big-endian Buffer");
+            }
+            std::copy_n(target.As<Napi::Buffer<uint8_t>>().Data(), sizeof(job->target), job->target);
+
+            Napi::Value threads = options.Get("threads");
+            if (threads.IsNumber())
+            {
+                job->threads = threads.As<Napi::Number>().Uint32Value();
+            }
+            Napi::Value pinThreads = options.Get("pinThreads");
+            if (pinThreads.IsBoolean())
+            {
+                job->pinThreads = pinThreads.As<Napi::Boolean>().Value();
+            }
+            Napi::Value coreOffset = options.Get("coreOffset");
+            if (coreOffset.IsNumber())
+            {
+                job->coreOffset = coreOffset.As<Napi::Number>().Uint32Value();
+            }
+
+            // Each call gets its own token, so starting a job never clears a
+            // cancel aimed at another. A caller mining in slices passes the
+            // generation it started under; once cancelMining() has moved on,
+            // later slices come back cancelled without searching.
+            auto cancel = std::make_shared<std::atomic<bool>>(false);
+            Napi::Value generation = options.Get("generation");
+            if (generation.IsNumber() &&
+                static_cast<uint64_t>(generation.As<Napi::Number>().Int64Value()) != miningGeneration_)
+            {
+                cancel->store(true);
+            }
+            else
+            {
+                miningJobs_.erase(std::remove_if(miningJobs_.begin(), miningJobs_.end(),
+                                                 [](const std::weak_ptr<std::atomic<bool>> &token)
+                                                 { return token.expired(); }),
+                                  miningJobs_.end());
+                miningJobs_.push_back(cancel);
+            }
+
+            return dispatcher_.run<MiningResult>(
+                env,
+                [job, cancel]()
+                { return Miner::mine(*job, cancel.get()); },
+                [cancel](Napi::Env env, MiningResult &result) -> Napi::Value
+                {
+                    Napi::Object object = Napi::Object::New(env);
+                    object.Set("found", Napi::Boolean::New(env, result.found));
+                    object.Set("cancelled", Napi::Boolean::New(env, !result.found && cancel->load()));
+                    if (result.found)
+                    {
+                        object.Set("nonce", Napi::Number::New(env, static_cast<double>(result.nonce)));
+                        object.Set("hash", Napi::Buffer<uint8_t>::Copy(env, result.hash, sizeof(result.hash)));
+                    }
+                    object.Set("hashes", Napi::Number::New(env, static_cast<double>(result.hashes)));
+                    object.Set("hashRate", Napi::Number::New(env, result.hashRate()));
+                    return object;
+                });
+        }
+
+        // Stops every mine() call in progress; they resolve with found=false
+        // and cancelled=true. Calls tagged with an older generation are
+        // cancelled too, even if they have not started yet.
+        Napi::Value CancelMining(const Napi::CallbackInfo &info)
+        {
+            cancelMiningJobs();
+            return info.Env().Undefined();
+        }
+
+        Napi::Value GetMiningGeneration(const Napi::CallbackInfo &info)
+        {
+            return Napi::Number::New(info.Env(), static_cast<double>(miningGeneration_));
+        }
+
+        void cancelMiningJobs()
+        {
+            ++miningGeneration_;
+            for (const auto &job : miningJobs_)
+            {
+                if (auto cancel = job.lock())
+                {
+                    cancel->store(true);
+                }
+            }
+            miningJobs_.clear();
+        }
+
+        Napi::Value SetSecurityLevel(const Napi::CallbackInfo &info)
+        {
+            Napi::Env env = info.Env();
+            if (info.Length() < 1 || !info[0].IsNumber())
+            {
+                throw Napi::TypeError::New(env, "level must be a number");
+            }
+            SecurityLevel level = optionalLevel(info, 0, crypto_);
+
+            auto deferred = Napi::Promise::Deferred::New(env);
+            try
+            {
+                crypto_.setSecurityLevel(level);
+                deferred.Resolve(env.Undefined());
+            }
+            catch (const QuantumError &e)
+            {
+                deferred.Reject(Napi::Error::New(env, e.what()).Value());
+            }
+            return deferred.Promise();
+        }
+
+        Napi::Value GetSecurityLevel(const Napi::CallbackInfo &info)
+        {
+            return Napi::Number::New(info.Env(), static_cast<double>(crypto_.securityLevel()));
+        }
+
+        // getParameterSet(level?) -> algorithm names and sizes
+        Napi::Value GetParameterSet(const Napi::CallbackInfo &info)
+        {
+            Napi::Env env = info.Env();
+            ParameterSetInfo set = crypto_.parameterSet(optionalLevel(info, 0, crypto_));
+            Napi::Object result = Napi::Object::New(env);
+            result.Set("level", Napi::Number::New(env, static_cast<double>(set.level)));
+            result.Set("available", Napi::Boolean::New(env, set.available));
+            result.Set("signatureAlgorithm", Napi::String::New(env, set.signatureAlgorithm));
+            result.Set("kemAlgorithm", Napi::String::New(env, set.kemAlgorithm));
+            result.Set("publicKeyLength", Napi::Number::New(env, static_cast<double>(set.publicKeyLength)));
+            result.Set("privateKeyLength", Napi::Number::New(env, static_cast<double>(set.privateKeyLength)));
+            result.Set("signatureLength", Napi::Number::New(env, static_cast<double>(set.signatureLength)));
+            result.Set("kemPublicKeyLength", Napi::Number::New(env, static_cast<double>(set.kemPublicKeyLength)));
+            result.Set("kemPrivateKeyLength", Napi::Number::New(env, static_cast<double>(set.kemPrivateKeyLength)));
+            result.Set("ciphertextLength", Napi::Number::New(env, static_cast<double>(set.ciphertextLength)));
+            result.Set("sharedSecretLength", Napi::Number::New(env, static_cast<double>(set.sharedSecretLength)));
+            return result;
+        }
+
+        Napi::Value GetSecureMemoryStats(const Napi::CallbackInfo &info)
+        {
+            Napi::Env env = info.Env();
+            SecureArenaStats stats = QuantumCrypto::secureMemoryStats();
+            Napi::Object result = Napi::Object::New(env);
+            result.Set("initialized", Napi::Boolean::New(env, stats.initialized));
+            result.Set("locked", Napi::Boolean::New(env, stats.locked));
+            result.Set("heapSize", Napi::Number::New(env, static_cast<double>(stats.heapSize)));
+            result.Set("heapUsed", Napi::Number::New(env, static_cast<double>(stats.heapUsed)));
+            result.Set("bytesInUse", Napi::Number::New(env, static_cast<double>(stats.bytesInUse)));
+            result.Set("highWater", Napi::Number::New(env, static_cast<double>(stats.highWater)));
+            result.Set("allocations", Napi::Number::New(env, static_cast<double>(stats.allocations)));
+            result.Set("cacheHits", Napi::Number::New(env, static_cast<double>(stats.cacheHits)));
+            result.Set("cachedBytes", Napi::Number::New(env, static_cast<double>(stats.cachedBytes)));
+            result.Set("fallbacks", Napi::Number::New(env, static_cast<double>(stats.fallbacks)));
+            return result;
+        }
+
+        // Synchronous: a DRBG draw is cheaper than a trip to the worker pool
+        Napi::Value RandomBytes(const Napi::CallbackInfo &info)
+        {
+            Napi::Env env = info.Env();
+            if (info.Length() < 1 || !info[0].IsNumber())
+            {
+                throw Napi::TypeError::New(env, "length must be a number");
+            }
+            uint32_t length = info[0].As<Napi::Number>().Uint32Value();
+            if (length == 0 || length > (1u << 20))
+            {
+                throw Napi::RangeError::New(env, "length must be between 1 and 1048576");
+            }
+            try
+            {
+                return toNodeBuffer(env, crypto_.generateSecureRandom(length));
+            }
+            catch (const QuantumError &e)
+            {
+                throw Napi::Error::New(env, e.what());
+            }
+        }
+
+        Napi::Value GetEntropyStats(const Napi::CallbackInfo &info)
+        {
+            Napi::Env env = info.Env();
+            EntropyStats stats = crypto_.entropyStats();
+            Napi::Object result = Napi::Object::New(env);
+            result.Set("bytesGenerated", Napi::Number::New(env, static_cast<double>(stats.bytesGenerated)));
+            result.Set("requests", Napi::Number::New(env, static_cast<double>(stats.requests)));
+            result.Set("instantiations", Napi::Number::New(env, static_cast<double>(stats.instantiations)));
+            result.Set("forkReseeds", Napi::Number::New(env, static_cast<double>(stats.forkReseeds)));
+            result.Set("failures", Napi::Number::New(env, static_cast<double>(stats.failures)));
+            result.Set("healthy", Napi::Boolean::New(env, stats.healthy));
+            return result;
+        }
+
+        Napi::Value GetSecurityLogStats(const Napi::CallbackInfo &info)
+        {
+            Napi::Env env = info.Env();
+            SecurityLogStats stats = crypto_.securityLogStats();
+            Napi::Object result = Napi::Object::New(env);
+            result.Set("queued", Napi::Number::New(env, static_cast<double>(stats.queued)));
+            result.Set("written", Napi::Number::New(env, static_cast<double>(stats.written)));
+            result.Set("suppressed", Napi::Number::New(env, static_cast<double>(stats.suppressed)));
+            result.Set("dropped", Napi::Number::New(env, static_cast<double>(stats.dropped)));
+            return result;
+        }
+
+        // Result of the latest background known-answer run; never runs one
+        Napi::Value GetHealthStatus(const Napi::CallbackInfo &info)
+        {
+            return healthStatusToObject(info.Env(), crypto_.healthStatus());
+        }
+
+        // Runs the known-answer tests on a worker and resolves to the status
+        Napi::Value RunHealthCheck(const Napi::CallbackInfo &info)
+        {
+            QuantumCrypto &crypto = crypto_;
+            return dispatcher_.run<HealthStatus>(
+                info.Env(),
+                [&crypto]()
+                {
+                    crypto.healthCheck();
+                    return crypto.healthStatus();
+                },
+                [](Napi::Env env, HealthStatus &status) -> Napi::Value
+                { return healthStatusToObject(env, status); });
+        }
+
+        // Latency snapshot for scraping; never blocks the crypto threads
+        Napi::Value GetOperationMetrics(const Napi::CallbackInfo &info)
+        {
+            Napi::Env env = info.Env();
+            std::vector<OperationMetrics> operations = SecurityMonitor::operationMetrics();
+            Napi::Array result = Napi::Array::New(env, operations.size());
+            for (size_t i = 0; i < operations.size(); ++i)
+            {
+                const OperationMetrics &metrics = operations[i];
+                Napi::Object entry = Napi::Object::New(env);
+                entry.Set("operation", Napi::String::New(env, metrics.operation));
+                entry.Set("count", Napi::Number::New(env, static_cast<double>(metrics.count)));
+                entry.Set("failures", Napi::Number::New(env, static_cast<double>(metrics.failures)));
+                entry.Set("totalMicros", Napi::Number::New(env, metrics.totalMicros));
+                entry.Set("windowCount", Napi::Number::New(env, static_cast<double>(metrics.windowCount)));
+                entry.Set("p50Micros", Napi::Number::New(env, metrics.p50Micros));
+                entry.Set("p90Micros", Napi::Number::New(env, metrics.p90Micros));
+                entry.Set("p99Micros", Napi::Number::New(env, metrics.p99Micros));
+                entry.Set("p999Micros", Napi::Number::New(env, metrics.p999Micros));
+                entry.Set("maxMicros", Napi::Number::New(env, metrics.maxMicros));
+                result.Set(static_cast<uint32_t>(i), entry);
+            }
+            return result;
+        }
+
+        Napi::Value GetVerifyCacheStats(const Napi::CallbackInfo &info)
+        {
+            Napi::Env env = info.Env();
+            VerifyCacheStats stats = crypto_.verifyCacheStats();
+            Napi::Object result = Napi::Object::New(env);
+            result.Set("hits", Napi::Number::New(env, static_cast<double>(stats.hits)));
+            result.Set("negativeHits", Napi::Number::New(env, static_cast<double>(stats.negativeHits)));
+            result.Set("misses", Napi::Number::New(env, static_cast<double>(stats.misses)));
+            result.Set("insertions", Napi::Number::New(env, static_cast<double>(stats.insertions)));
+            result.Set("evictions", Napi::Number::New(env, static_cast<double>(stats.evictions)));
+            result.Set("entries", Napi::Number::New(env, static_cast<double>(stats.entries)));
+            result.Set("capacity", Napi::Number::New(env, static_cast<double>(stats.capacity)));
+            return result;
+        }
+
+        // preparePublicKey(kind, publicKey, levelOrVariant?) where kind is
+        // 'dilithium' or 'falcon'. The handle keeps the prepared key alive
+        // even after the native cache evicts it.
+        Napi::Value PreparePublicKey(const Napi::CallbackInfo &info)
+        {
+            Napi::Env env = info.Env();
+            if (info.Length() < 1 || !info[0].IsString())
+            {
+                throw Napi::TypeError::New(env, "kind must be a string");
+            }
+            auto buffer = requireBuffer(info, 1, "publicKey");
+            ByteSpan publicKey(buffer.Data(), buffer.Length());
+            std::string kind = info[0].As<Napi::String>().Utf8Value();
+
+            auto handle = std::make_unique<PreparedKey>();
+            try
+            {
+                if (kind == "dilithium")
+                {
+                    *handle = crypto_.preparePublicKey(optionalLevel(info, 2, crypto_), publicKey);
+                }
+                else if (kind == "falcon")
+                {
+                    *handle = crypto_.prepareFalconPublicKey(optionalFalconVariant(info, 2), publicKey);
+                }
+                else
+                {
+                    throw Napi::RangeError::New(env, "kind must be 'dilithium' or 'falcon'");
+                }
+            }
+            catch (const QuantumError &e)
+            {
+                throw Napi::RangeError::New(env, e.what());
+            }
+            auto external = Napi::External<PreparedKey>::New(env, handle.release(), [](Napi::Env, PreparedKey *owned)
+                                                             { delete owned; });
+            external.TypeTag(&PREPARED_KEY_TAG);
+            return external;
+        }
+
+        PreparedKey requirePreparedKey(const Napi::CallbackInfo &info)
+        {
+            if (info.Length() < 1 || !info[0].IsExternal() ||
+                !info[0].As<Napi::External<PreparedKey>>().CheckTypeTag(&PREPARED_KEY_TAG))
+            {
+                throw Napi::TypeError::New(info.Env(), "handle must come from preparePublicKey");
+            }
+            return *info[0].As<Napi::External<PreparedKey>>().Data();
+        }
+
+        // verifyPrepared(handle, message, signature)
+        Napi::Value VerifyPrepared(const Napi::CallbackInfo &info)
+        {
+            PreparedKey key = requirePreparedKey(info);
+            std::vector<Napi::Value> pinned;
+            ByteSpan message = borrowBuffer(info, 1, "message", pinned);
+            ByteSpan signature = borrowBuffer(info, 2, "signature", pinned);
+
+            QuantumCrypto &crypto = crypto_;
+            return dispatcher_.run<bool>(
+                info.Env(),
+                [&crypto, key, message, signature]()
+                { return crypto.verify(*key, message, signature); },
+                [](Napi::Env env, bool &valid) -> Napi::Value
+                { return Napi::Boolean::New(env, valid); },
+                pinned);
+        }
+
+        // verifyPreparedBatch(handle, items: {message, signature}[], earlyAbort?)
+        // verifies many messages from one signer.
+        Napi::Value VerifyPreparedBatch(const Napi::CallbackInfo &info)
+        {
+            Napi::Env env = info.Env();
+            PreparedKey key = requirePreparedKey(info);
+            if (info.Length() < 2 || !info[1].IsArray())
+            {
+                throw Napi::TypeError::New(env, "items must be an array");
+            }
+            bool earlyAbort = info.Length() > 2 && info[2].ToBoolean().Value();
+
+            struct Batch
+            {
+                std::vector<ByteSpan> messages;
+                std::vector<ByteSpan> signatures;
+            };
+            auto batch = std::make_shared<Batch>();
+            Napi::Array items = info[1].As<Napi::Array>();
+            std::vector<Napi::Value> pinned;
+            pinned.reserve(items.Length() * 2);
+            batch->messages.reserve(items.Length());
+            batch->signatures.reserve(items.Length());
+            for (uint32_t i = 0; i < items.Length(); ++i)
+            {
+                Napi::Value item = items.Get(i);
+                if (!item.IsObject())
+                {
+                    throw Napi::TypeError::New(env, "batch items must be objects");
+                }
+                Napi::Value message = item.As<Napi::Object>().Get("message");
+                Napi::Value signature = item.As<Napi::Object>().Get("signature");
+                if (!message.IsBuffer() || !signature.IsBuffer())
+                {
+                    throw Napi::TypeError::New(env, "batch item message and signature must be Buffers");
+                }
+                auto messageBuffer = message.As<Napi::Buffer<uint8_t>>();
+                auto signatureBuffer = signature.As<Napi::Buffer<uint8_t>>();
+                pinned.push_back(messageBuffer);
+                pinned.push_back(signatureBuffer);
+                batch->messages.emplace_back(messageBuffer.Data(), messageBuffer.Length());
+                batch->signatures.emplace_back(signatureBuffer.Data(), signatureBuffer.Length());
+            }
+
+            QuantumCrypto &crypto = crypto_;
+            return dispatcher_.run<BatchVerifyResult>(
+                env,
+                [&crypto, key, batch, earlyAbort]()
+                {
+                    return crypto.verifyBatch(*key, batch->messages.data(), batch->signatures.data(),
+                                              batch->messages.size(), earlyAbort);
+                },
+                batchResultToObject, pinned);
+        }
+
+        Napi::Value GetPreparedKeyStats(const Napi::CallbackInfo &info)
+        {
+            Napi::Env env = info.Env();
+            PreparedKeyStats stats = crypto_.preparedKeyStats();
+            Napi::Object result = Napi::Object::New(env);
+            result.Set("hits", Napi::Number::New(env, static_cast<double>(stats.hits)));
+            result.Set("misses", Napi::Number::New(env, static_cast<double>(stats.misses)));
+            result.Set("evictions", Napi::Number::New(env, static_cast<double>(stats.evictions)));
+            result.Set("entries", Napi::Number::New(env, static_cast<double>(stats.entries)));
+            result.Set("capacity", Napi::Number::New(env, static_cast<double>(stats.capacity)));
+            return result;
+        }
+
+        Napi::Value ClearVerifyCache(const Napi::CallbackInfo &info)
+        {
+            crypto_.clearVerifyCache();
+            return info.Env().Undefined();
+        }
+
+        // setKeyPoolDepth(kind, depth, levelOrVariant?) where kind is
+        // 'dilithium', 'kyber' or 'falcon'. Depth 0 stops the pool.
+        Napi::Value SetKeyPoolDepth(const Napi::CallbackInfo &info)
+        {
+            Napi::Env env = info.Env();
+            if (info.Length() < 1 || !info[0].IsString())
+            {
+                throw Napi::TypeError::New(env, "kind must be a string");
+            }
+            if (info.Length() < 2 || !info[1].IsNumber())
+            {
+                throw Napi::TypeError::New(env, "depth must be a number");
+            }
+            std::string kind = info[0].As<Napi::String>().Utf8Value();
+            size_t depth = info[1].As<Napi::Number>().Uint32Value();
+            try
+            {
+                if (kind == "dilithium")
+                {
+                    crypto_.setDilithiumKeyPoolDepth(optionalLevel(info, 2, crypto_), depth);
+                }
+                else if (kind == "kyber")
+                {
+                    crypto_.setKyberKeyPoolDepth(optionalLevel(info, 2, crypto_), depth);
+                }
+                else if (kind == "falcon")
+                {
+                    crypto_.setFalconKeyPoolDepth(optionalFalconVariant(info, 2), depth);
+                }
+                else
+                {
+                    throw Napi::RangeError::New(env, "kind must be 'dilithium', 'kyber' or 'falcon'");
+                }
+            }
+            catch (const QuantumError &e)
+            {
+                throw Napi::Error::New(env, e.what());
+            }
+            return env.Undefined();
+        }
+
+        Napi::Value GetKeyPoolStats(const Napi::CallbackInfo &info)
+        {
+            Napi::Env env = info.Env();
+            std::vector<KeyPoolStats> pools = crypto_.keyPoolStats();
+            Napi::Array result = Napi::Array::New(env, pools.size());
+            for (size_t i = 0; i < pools.size(); ++i)
+            {
+                const KeyPoolStats &stats = pools[i];
+                Napi::Object entry = Napi::Object::New(env);
+                entry.Set("algorithm", Napi::String::New(env, stats.algorithm));
+                entry.Set("depth", Napi::Number::New(env, static_cast<double>(stats.depth)));
+                entry.Set("available", Napi::Number::New(env, static_cast<double>(stats.available)));
+                entry.Set("hits", Napi::Number::New(env, static_cast<double>(stats.hits)));
+                entry.Set("misses", Napi::Number::New(env, static_cast<double>(stats.misses)));
+                entry.Set("generated", Napi::Number::New(env, static_cast<double>(stats.generated)));
+                result.Set(static_cast<uint32_t>(i), entry);
+            }
+            return result;
+        }
+
+        Napi::Value SetWorkerThreads(const Napi::CallbackInfo &info)
+        {
+            Napi::Env env = info.Env();
+            if (info.Length() < 1 || !info[0].IsNumber())
+            {
+                throw Napi::TypeError::New(env, "threads must be a number");
+            }
+            uint32_t threads = info[0].As<Napi::Number>().Uint32Value();
+            if (threads == 0)
+            {
+                throw Napi::RangeError::New(env, "threads must be positive");
+            }
+            dispatcher_.resize(threads);
+            return env.Undefined();
+        }
+
+        Napi::Value GetWorkerThreads(const Napi::CallbackInfo &info)
+        {
+            return Napi::Number::New(info.Env(), static_cast<double>(dispatcher_.threads()));
+        }
+
+        QuantumCrypto &crypto_;
+        // Cancel tokens of mine() calls that may still be running. Only
+        // touched on the JS thread; the tasks own the tokens themselves.
+        std::vector<std::weak_ptr<std::atomic<bool>>> miningJobs_;
+        uint64_t miningGeneration_{0};
+        AsyncDispatcher dispatcher_;
+    };
+
+} // namespace quantum
+
+NODE_API_ADDON(quantum::QuantumAddon)
@@ -0,0 +1,156 @@
+#include "async_dispatcher.h"
+#include "security_monitor.h"
+#include <chrono>
+#include <exception>
+#include <thread>
+
+namespace quantum
+{
+
+    AsyncDispatcher::AsyncDispatcher(Napi::Env env, size_t threads)
+        : pool_(std::make_unique<ThreadPool>(threads))
+    {
+        auto shared = std::make_unique<Shared>();
+        shared->completer = Completer::New(env, "h3tag-quantum", 0, 1, shared.get(), &AsyncDispatcher::finalize,
+                                           shared.get());
+        shared_ = shared.release();
+
+        // Idle until the first task is queued.
+        shared_->completer.Unref(env);
+    }
+
+    AsyncDispatcher::~AsyncDispatcher()
+    {
+        // Join the workers first so no task can post to a released function.
+        // Once released, shared_ belongs to the completer's finalizer.
+        pool_.reset();
+        shared_->completer.Release();
+    }
+
+    Napi::Promise AsyncDispatcher::queue(Napi::Env env, std::unique_ptr<AsyncTask> task,
+                                         const std::vector<Napi::Value> &pinned)
+    {
+        auto *completion = new Completion{Napi::Promise::Deferred::New(env), std::move(task), false, std::string(), {}};
+        completion->pins.reserve(pinned.size());
+        for (const Napi::Value &value : pinned)
+        {
+            completion->pins.push_back(Napi::Persistent(value));
+        }
+        Napi::Promise promise = completion->deferred.Promise();
+
+        if (shared_->pending++ == 0)
+        {
+            shared_->completer.Ref(env);
+        }
+
+        Completer completer = shared_->completer;
+        auto queuedAt = std::chrono::steady_clock::now();
+        pool_->submit([completion, completer, queuedAt]()
+                      {
+            auto waited = std::chrono::steady_clock::now() - queuedAt;
+            SecurityMonitor::recordOperation(
+                MonitoredOperation::QUEUE_WAIT,
+                static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(waited).count()),
+                true);
+
+            try
+            {
+                completion->task->execute();
+            }
+            catch (const std::exception &e)
+            {
+                completion->failed = true;
+                completion->error = e.what();
+            }
+            catch (...)
+            {
+                completion->failed = true;
+                completion->error = "Unknown native error";
+            }
+
+            if (completer.BlockingCall(completion) != napi_ok)
+            {
+                // The environment is shutting down; nobody is waiting.
+                discard(completion);
+            } });
+
+        return promise;
+    }
+
+    void AsyncDispatcher::settle(Napi::Env env, Napi::Function, Shared *shared, Completion *completion)
+    {
+        if (static_cast<napi_env>(env) == nullptr)
+        {
+            discard(completion);
+            return;
+        }
+        // Pins are released here, on the JS thread, with the completion
+        std::unique_ptr<Completion> owned(completion);
+
+        if (--shared->pending == 0)
+        {
+            shared->completer.Unref(env);
+        }
+
+        if (owned->failed)
+        {
+            owned->deferred.Reject(Napi::Error::New(env, owned->error).Value());
+            return;
+        }
+
+        try
+        {
+            owned->deferred.Resolve(owned->task->resolve(env));
+        }
+        catch (const Napi::Error &e)
+        {
+            owned->deferred.Reject(e.Value());
+        }
+        catch (const std::exception &e)
+        {
+            owned->deferred.Reject(Napi::Error::New(env, e.what()).Value());
+        }
+    }
+
+    void AsyncDispatcher::finalize(Napi::Env, Shared *, Shared *shared)
+    {
+        delete shared;
+    }
+
+    void AsyncDispatcher::discard(Completion *completion)
+    {
+        for (auto &pin : completion->pins)
+        {
+            pin.SuppressDestruct();
+        }
+        delete completion;
+    }
+
+    void AsyncDispatcher::resize(size_t threads)
+    {
+        auto replacement = std::make_unique<ThreadPool>(threads);
+        pool_.swap(replacement);
+
+        // Joining the old workers here would block the event loop until every
+        // task already queued on them has run. Drain them on a detached
+        // reaper instead; it holds its own reference on the completer, which
+        // keeps Shared alive until the stragglers have settled even if the
+        // dispatcher is gone by then.
+        Completer completer = shared_->completer;
+        if (completer.Acquire() != napi_ok)
+        {
+            return;
+        }
+        std::thread([retired = std::move(replacement), completer]() mutable
+                    {
+            retired.reset();
+            completer.Release(); })
+            .detach();
+    }
+
+    size_t AsyncDispatcher::threads() const
+    {
+        return pool_->size();
+    }
+
+} // namespace quantum
@@ -0,0 +1,123 @@
+#ifndef ASYNC_DISPATCHER_H
+#define ASYNC_DISPATCHER_H
+
+#include <napi.h>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+#include "thread_pool.h"
+
+namespace quantum
+{
+
+    // Unit of work executed off the V8 thread. execute() runs on a pool
+    // worker; resolve() runs back on the JS thread and builds the value the
+    // promise settles with.
+    class AsyncTask
+    {
+    public:
+        virtual ~AsyncTask() = default;
+        virtual void execute() = 0;
+        virtual Napi::Value resolve(Napi::Env env) = 0;
+    };
+
+    // AsyncTask built from a pair of callables.
+    template <typename Result>
+    class LambdaTask : public AsyncTask
+    {
+    public:
+        using Work = std::function<Result()>;
+        using Convert = std::function<Napi::Value(Napi::Env, Result &)>;
+
+        LambdaTask(Work work, Convert convert)
+            : work_(std::move(work)), convert_(std::move(convert)) {}
+
+        void execute() override
+        {
+            result_.emplace(work_());
+        }
+
+        Napi::Value resolve(Napi::Env env) override
+        {
+            return convert_(env, *result_);
+        }
+
+    private:
+        Work work_;
+        Convert convert_;
+        std::optional<Result> result_;
+    };
+
+    // Runs AsyncTasks on a dedicated native pool rather than the libuv
+    // threadpool and settles their promises through a single thread-safe
+    // function. The event loop is only kept alive while work is pending.
+    class AsyncDispatcher
+    {
+    public:
+        AsyncDispatcher(Napi::Env env, size_t threads);
+        ~AsyncDispatcher();
+
+        AsyncDispatcher(const AsyncDispatcher &) = delete;
+        AsyncDispatcher &operator=(const AsyncDispatcher &) = delete;
+
+        // Must be called on the JS thread. Values in `pinned` are kept
+        // reachable until the promise settles, so the task may read the
+        // memory of pinned Buffers in place instead of copying it.
+        Napi::Promise queue(Napi::Env env, std::unique_ptr<AsyncTask> task,
+                            const std::vector<Napi::Value> &pinned = {});
+
+        template <typename Result>
+        Napi::Promise run(Napi::Env env,
+                          typename LambdaTask<Result>::Work work,
+                          typename LambdaTask<Result>::Convert convert,
+                          const std::vector<Napi::Value> &pinned = {})
+        {
+            return queue(env, std::make_unique<LambdaTask<Result>>(std::move(work), std::move(convert)), pinned);
+        }
+
+        // Replace the worker pool. Tasks already queued on the old pool still
+        // run and settle; the old workers are joined off the JS thread.
+        void resize(size_t threads);
+        size_t threads() const;
+
+    private:
+        struct Completion
+        {
+            Napi::Promise::Deferred deferred;
+            std::unique_ptr<AsyncTask> task;
+            bool failed{false};
+            std::string error;
+            std::vector<Napi::Reference<Napi::Value>> pins;
+        };
+
+        struct Shared;
+
+        // Deletes a completion whose environment is gone. References can only
+        // be released on a live JS thread, so the pins are abandoned.
+        static void discard(Completion *completion);
+
+        static void settle(Napi::Env env, Napi::Function, Shared *shared, Completion *completion);
+
+        using Completer = Napi::TypedThreadSafeFunction<Shared, Completion, &AsyncDispatcher::settle>;
+
+        // State the completions touch when they settle. It is the completer's
+        // context and is deleted by its finalizer, once the dispatcher and
+        // every resize() reaper have released it, so tasks finishing on a
+        // retired pool never reach back into a destroyed dispatcher.
+        struct Shared
+        {
+            Completer completer;
+            size_t pending{0}; // JS thread only
+        };
+
+        static void finalize(Napi::Env, Shared *, Shared *shared);
+
+        Shared *shared_;
+        std::unique_ptr<ThreadPool> pool_;
+    };
+
+} // namespace quantum
+
+#endif // ASYNC_DISPATCHER_H
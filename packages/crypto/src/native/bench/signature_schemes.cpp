@@ -0,0 +1,144 @@
+// Signature scheme comparison benchmark for QuantumCrypto.
+//
+// Usage: signature_schemes [operations]
+//
+// Signs and verifies the same message set with every Dilithium / ML-DSA
+// parameter set and both Falcon variants on one thread, and prints
+// throughput next to the bytes each transaction carries (signature plus
+// public key). Schemes missing from the linked liboqs are skipped.
+
+#include "../quantum.h"
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <functional>
+#include <string>
+#include <vector>
+
+using namespace quantum;
+
+namespace
+{
+    struct Scheme
+    {
+        std::string name;
+        std::function<KeyPair()> generate;
+        std::function<Signature(const Buffer &, const PrivateKey &)> sign;
+        std::function<bool(const Buffer &, const Signature &, const PublicKey &)> verify;
+    };
+
+    template <typename Fn>
+    double perSecond(size_t operations, Fn &&fn)
+    {
+        auto begin = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < operations; ++i)
+        {
+            fn(i);
+        }
+        auto elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+        return static_cast<double>(operations) / elapsed;
+    }
+
+    void run(QuantumCrypto &crypto, const Scheme &scheme, size_t operations)
+    {
+        KeyPair keyPair = scheme.generate();
+        PrivateKey privateKey(keyPair.privateKey.data(), keyPair.privateKey.size());
+        PublicKey publicKey(keyPair.publicKey.data(), keyPair.publicKey.size());
+
+        std::vector<Buffer> messages;
+        for (size_t i = 0; i < 64; ++i)
+        {
+            messages.push_back(crypto.generateSecureRandom(256));
+        }
+
+        double keygenRate = perSecond(operations / 10 + 1, [&](size_t)
+                                      { scheme.generate(); });
+
+        std::vector<Signature> signatures;
+        size_t signatureBytes = 0;
+        double signRate = perSecond(operations, [&](size_t i)
+                                    {
+            Signature signature = scheme.sign(messages[i % messages.size()], privateKey);
+            signatureBytes += signature.size();
+            if (signatures.size() < messages.size())
+            {
+                signatures.push_back(std::move(signature));
+            } });
+
+        double verifyRate = perSecond(operations, [&](size_t i)
+                                      {
+            size_t index = i % signatures.size();
+            if (!scheme.verify(messages[index], signatures[index], publicKey))
+            {
+                std::fprintf(stderr, "%s: unexpected verification failure\n", scheme.name.c_str());
+                std::exit(1);
+            } });
+
+        double averageSignature = static_cast<double>(signatureBytes) / static_cast<double>(operations);
+        std::printf("%-12s %10.0f %10.0f %10.0f %8.0f %8zu %10.0f\n",
+                    scheme.name.c_str(), keygenRate, signRate, verifyRate,
+                    averageSignature, publicKey.size(), averageSignature + publicKey.size());
+    }
+}
+
+int main(int argc, char **argv)
+{
+    size_t operations = 1000;
+    if (argc > 1)
+    {
+        operations = std::strtoull(argv[1], nullptr, 10);
+    }
+    if (operations == 0)
+    {
+        operations = 1;
+    }
+
+    // Repeated messages would otherwise be served from the verify cache
+    SecurityParams params = SecurityParams::DEFAULT;
+    params.verifyCacheEntries = 0;
+    QuantumCrypto &crypto = QuantumCrypto::getInstance(params);
+
+    std::vector<Scheme> schemes;
+    for (SecurityLevel level : {SecurityLevel::LEGACY, SecurityLevel::NORMAL, SecurityLevel::HIGH, SecurityLevel::PARANOID})
+    {
+        ParameterSetInfo info = crypto.parameterSet(level);
+        if (!info.available)
+        {
+            continue;
+        }
+        schemes.push_back(Scheme{
+            info.signatureAlgorithm,
+            [&crypto, level]()
+            { return crypto.generateDilithiumKeyPair(level); },
+            [&crypto, level](const Buffer &message, const PrivateKey &key)
+            { return crypto.sign(level, message, key); },
+            [&crypto, level](const Buffer &message, const Signature &signature, const PublicKey &key)
+            { return crypto.verify(level, message, signature, key); }});
+    }
+    for (FalconVariant variant : {FalconVariant::FALCON_512, FalconVariant::FALCON_1024})
+    {
+        schemes.push_back(Scheme{
+            variant == FalconVariant::FALCON_512 ? "Falcon-512" : "Falcon-1024",
+            [&crypto, variant]()
+            { return crypto.generateFalconKeyPair(variant); },
+            [&crypto, variant](const Buffer &message, const PrivateKey &key)
+            { return crypto.falconSign(variant, message, key); },
+            [&crypto, variant](const Buffer &message, const Signature &signature, const PublicKey &key)
+            { return crypto.falconVerify(variant, message, signature, key); }});
+    }
+
+    std::printf("%-12s %10s %10s %10s %8s %8s %10s\n",
+                "scheme", "keygen/s", "sign/s", "verify/s", "sig B", "pk B", "B/tx");
+    for (const Scheme &scheme : schemes)
+    {
+        try
+        {
+            run(crypto, scheme, operations);
+        }
+        catch (const QuantumError &e)
+        {
+            std::printf("%-12s skipped: %s\n", scheme.name.c_str(), e.what());
+        }
+    }
+    return 0;
+}
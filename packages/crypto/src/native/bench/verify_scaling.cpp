@@ -0,0 +1,116 @@
+// Verify throughput scaling benchmark for QuantumCrypto.
+//
+// Usage: verify_scaling [max_threads] [verifies_per_thread]
+//
+// Runs the same verify workload with 1..max_threads threads against the
+// shared QuantumCrypto instance and prints throughput and speedup relative
+// to the single-threaded run.
+
+#include "../quantum.h"
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <thread>
+#include <vector>
+
+using namespace quantum;
+
+namespace
+{
+    struct Sample
+    {
+        Buffer message;
+        Signature signature;
+    };
+
+    double runVerifies(QuantumCrypto &crypto, const std::vector<Sample> &samples,
+                       const PublicKey &publicKey, unsigned threads, size_t perThread)
+    {
+        std::atomic<bool> start{false};
+        std::atomic<size_t> failures{0};
+        std::vector<std::thread> workers;
+        workers.reserve(threads);
+
+        for (unsigned t = 0; t < threads; ++t)
+        {
+            workers.emplace_back([&, t]()
+                                 {
+                while (!start.load(std::memory_order_acquire))
+                {
+                    std::this_thread::yield();
+                }
+                for (size_t i = 0; i < perThread; ++i)
+                {
+                    const Sample &sample = samples[(t + i) % samples.size()];
+                    if (!crypto.verify(sample.message, sample.signature, publicKey))
+                    {
+                        failures.fetch_add(1, std::memory_order_relaxed);
+                    }
+                } });
+        }
+
+        auto begin = std::chrono::steady_clock::now();
+        start.store(true, std::memory_order_release);
+        for (auto &worker : workers)
+        {
+            worker.join();
+        }
+        auto elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+
+        if (failures.load() != 0)
+        {
+            std::fprintf(stderr, "unexpected verification failures: %zu\n", failures.load());
+            std::exit(1);
+        }
+        return static_cast<double>(threads * perThread) / elapsed;
+    }
+}
+
+int main(int argc, char **argv)
+{
+    unsigned maxThreads = std::thread::hardware_concurrency();
+    size_t perThread = 2000;
+    if (argc > 1)
+    {
+        maxThreads = static_cast<unsigned>(std::strtoul(argv[1], nullptr, 10));
+    }
+    if (argc > 2)
+    {
+        perThread = std::strtoull(argv[2], nullptr, 10);
+    }
+    if (maxThreads == 0)
+    {
+        maxThreads = 1;
+    }
+
+    // The samples repeat, so the verify cache would turn this into a cache
+    // benchmark; measure the liboqs path itself.
+    SecurityParams params = SecurityParams::DEFAULT;
+    params.verifyCacheEntries = 0;
+    QuantumCrypto &crypto = QuantumCrypto::getInstance(params);
+    KeyPair keyPair = crypto.generateDilithiumKeyPair();
+    PrivateKey privateKey(keyPair.privateKey.data(), keyPair.privateKey.size());
+    PublicKey publicKey(keyPair.publicKey.data(), keyPair.publicKey.size());
+
+    std::vector<Sample> samples;
+    for (int i = 0; i < 64; ++i)
+    {
+        Buffer message = crypto.generateSecureRandom(256);
+        Signature signature = crypto.sign(message, privateKey);
+        samples.push_back(Sample{std::move(message), std::move(signature)});
+    }
+
+    std::printf("%8s %14s %10s\n", "threads", "verifies/s", "speedup");
+    double baseline = 0.0;
+    for (unsigned threads = 1; threads <= maxThreads; ++threads)
+    {
+        double rate = runVerifies(crypto, samples, publicKey, threads, perThread);
+        if (threads == 1)
+        {
+            baseline = rate;
+        }
+        std::printf("%8u %14.0f %9.2fx\n", threads, rate, rate / baseline);
+    }
+    return 0;
+}
@@ -1,23 +1,209 @@
 #include "entropy_pool.h"
+#include <openssl/core_names.h>
+#include <openssl/evp.h>
+#include <openssl/params.h>
 #include <openssl/rand.h>
 #include <stdexcept>
 #include <mutex>
 #include <atomic>
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <thread>
 #include <vector>
 #include <limits>
+#ifdef _WIN32
+#include <process.h>
+#else
+#include <pthread.h>
+#include <unistd.h>
+#endif
 
-struct EntropyPool::Implementation
+namespace
 {
-    std::mutex mutex;
-    std::atomic<size_t> entropyLevel{0};
-    const size_t MIN_ENTROPY_LEVEL = 256; // Minimum acceptable entropy level
+    constexpr unsigned int DRBG_STRENGTH = 256;
+    // CTR-DRBG rejects larger single requests
+    constexpr size_t MAX_REQUEST = size_t(1) << 16;
+
+    struct ThreadDrbg;
+
+    // Live per-thread DRBGs, for stats() and fork handling. Only touched
+    // when a thread first draws bytes, when it exits and by stats(); the
+    // getBytes path never locks it.
+    struct Registry
+    {
+        std::mutex mutex;
+        std::vector<ThreadDrbg *> live;
+        uint64_t retiredBytes{0};
+        uint64_t retiredRequests{0};
+        std::atomic<uint64_t> instantiations{0};
+        std::atomic<uint64_t> forkReseeds{0};
+        std::atomic<uint64_t> failures{0};
+        // Bumped in the child after fork(); a DRBG from an older generation
+        // holds the parent's state and must not be used again
+        std::atomic<uint64_t> forkGeneration{0};
+    };
+
+    void installForkHandlers();
+
+    // Never destroyed: threads may exit after static destruction has begun
+    Registry &registry()
+    {
+        static Registry *instance = []()
+        {
+            auto *created = new Registry();
+            installForkHandlers();
+            return created;
+        }();
+        return *instance;
+    }
+
+    EVP_RAND *drbgMethod()
+    {
+        static EVP_RAND *method = EVP_RAND_fetch(nullptr, "CTR-DRBG", nullptr);
+        return method;
+    }
+
+    struct ThreadDrbg
+    {
+        EVP_RAND_CTX *ctx{nullptr};
+        uint64_t generation{0};
+        bool registered{false};
+        // Written only by the owning thread; read by stats()
+        std::atomic<uint64_t> bytes{0};
+        std::atomic<uint64_t> requests{0};
+
+        ~ThreadDrbg()
+        {
+            EVP_RAND_CTX_free(ctx);
+            if (registered)
+            {
+                Registry &reg = registry();
+                std::lock_guard<std::mutex> lock(reg.mutex);
+                reg.live.erase(std::remove(reg.live.begin(), reg.live.end(), this), reg.live.end());
+                reg.retiredBytes += bytes.load(std::memory_order_relaxed);
+                reg.retiredRequests += requests.load(std::memory_order_relaxed);
+            }
+        }
 
+        EVP_RAND_CTX *get()
+        {
+            Registry &reg = registry();
+            uint64_t current = reg.forkGeneration.load(std::memory_order_acquire);
+            if (ctx && generation != current)
+            {
+                EVP_RAND_CTX_free(ctx);
+                ctx = nullptr;
+                reg.forkReseeds.fetch_add(1, std::memory_order_relaxed);
+            }
+            if (!ctx)
+            {
+                instantiate(reg, current);
+            }
+            return ctx;
+        }
+
+        void instantiate(Registry &reg, uint64_t current)
+        {
+            if (!registered)
+            {
+                std::lock_guard<std::mutex> lock(reg.mutex);
+                reg.live.push_back(this);
+                registered = true;
+            }
+
+            // No parent: the DRBG seeds and reseeds straight from the OS
+            EVP_RAND_CTX *created = drbgMethod() ? EVP_RAND_CTX_new(drbgMethod(), nullptr) : nullptr;
+            if (!created)
+            {
+                reg.failures.fetch_add(1, std::memory_order_relaxed);
+                throw std::runtime_error("Failed to create DRBG");
+            }
+
+            // Personalization keeps instances distinct even if two of them
+            // were handed the same seed
+            struct
+            {
+                int64_t pid;
+                size_t thread;
+                uint64_t generation;
+                int64_t time;
+            } personalization;
+            std::memset(&personalization, 0, sizeof(personalization));
+#ifdef _WIN32
+            personalization.pid = _getpid();
+#else
+            personalization.pid = getpid();
+#endif
+            personalization.thread = std::hash<std::thread::id>()(std::this_thread::get_id());
+            personalization.generation = current;
+            personalization.time = std::chrono::steady_clock::now().time_since_epoch().count();
+
+            char cipher[] = "AES-256-CTR";
+            OSSL_PARAM params[] = {
+                OSSL_PARAM_construct_utf8_string(OSSL_DRBG_PARAM_CIPHER, cipher, 0),
+                OSSL_PARAM_construct_end()};
+
+            if (EVP_RAND_instantiate(created, DRBG_STRENGTH, 0,
+                                     reinterpret_cast<const unsigned char *>(&personalization),
+                                     sizeof(personalization), params) != 1)
+            {
+                EVP_RAND_CTX_free(created);
+                reg.failures.fetch_add(1, std::memory_order_relaxed);
+                throw std::runtime_error("Failed to seed DRBG");
+            }
+
+            ctx = created;
+            generation = current;
+            reg.instantiations.fetch_add(1, std::memory_order_relaxed);
+        }
+    };
+
+    thread_local ThreadDrbg threadDrbg;
+
+    void forkPrepare()
+    {
+        registry().mutex.lock();
+    }
+
+    void forkParent()
+    {
+        registry().mutex.unlock();
+    }
+
+    void forkChild()
+    {
+        // Only the forking thread survives; the other DRBGs are unreachable
+        Registry &reg = registry();
+        ThreadDrbg *self = threadDrbg.registered ? &threadDrbg : nullptr;
+        reg.live.clear();
+        if (self)
+        {
+            reg.live.push_back(self);
+        }
+        reg.forkGeneration.fetch_add(1, std::memory_order_release);
+        reg.mutex.unlock();
+    }
+
+    // Windows has no fork()
+    void installForkHandlers()
+    {
+#ifndef _WIN32
+        pthread_atfork(forkPrepare, forkParent, forkChild);
+#endif
+    }
+}
+
+struct EntropyPool::Implementation
+{
     Implementation()
     {
         if (RAND_status() != 1)
         {
             throw std::runtime_error("Insufficient entropy available");
         }
+        // Fail at startup rather than on the first request
+        threadDrbg.get();
     }
 };
 
@@ -34,19 +220,65 @@ std::vector<uint8_t> EntropyPool::getBytes(size_t length)
         throw std::runtime_error("Requested length exceeds maximum allowable size");
     }
 
-    std::lock_guard<std::mutex> lock(pImpl->mutex);
     std::vector<uint8_t> bytes(length);
+    fill(bytes.data(), length);
+    return bytes;
+}
 
-    if (RAND_bytes(bytes.data(), static_cast<int>(length)) != 1)
+void EntropyPool::fill(uint8_t *out, size_t length)
+{
+    EVP_RAND_CTX *ctx = threadDrbg.get();
+    for (size_t offset = 0; offset < length; offset += MAX_REQUEST)
     {
-        throw std::runtime_error("Failed to generate random bytes");
+        size_t chunk = std::min(MAX_REQUEST, length - offset);
+        if (EVP_RAND_generate(ctx, out + offset, chunk, DRBG_STRENGTH, 0, nullptr, 0) != 1)
+        {
+            registry().failures.fetch_add(1, std::memory_order_relaxed);
+            throw std::runtime_error("Failed to generate random bytes");
+        }
     }
 
-    pImpl->entropyLevel += length;
-    return bytes;
+    threadDrbg.bytes.store(threadDrbg.bytes.load(std::memory_order_relaxed) + length,
+                           std::memory_order_relaxed);
+    threadDrbg.requests.store(threadDrbg.requests.load(std::memory_order_relaxed) + 1,
+                              std::memory_order_relaxed);
 }
 
+// The OS source is available and this thread's DRBG is seeded and usable
 bool EntropyPool::hasGoodQuality() const
 {
-    return pImpl->entropyLevel.load() >= pImpl->MIN_ENTROPY_LEVEL;
+    if (RAND_status() != 1)
+    {
+        return false;
+    }
+    try
+    {
+        return EVP_RAND_get_state(threadDrbg.get()) == EVP_RAND_STATE_READY;
+    }
+    catch (const std::exception &)
+    {
+        return false;
+    }
+}
+
+// Counters are process-wide: the per-thread DRBGs are shared by every pool
+EntropyStats EntropyPool::stats() const
+{
+    Registry &reg = registry();
+    EntropyStats stats;
+    {
+        std::lock_guard<std::mutex> lock(reg.mutex);
+        stats.bytesGenerated = reg.retiredBytes;
+        stats.requests = reg.retiredRequests;
+        for (const ThreadDrbg *drbg : reg.live)
+        {
+            stats.bytesGenerated += drbg->bytes.load(std::memory_order_relaxed);
+            stats.requests += drbg->requests.load(std::memory_order_relaxed);
+        }
+    }
+    stats.instantiations = reg.instantiations.load(std::memory_order_relaxed);
+    stats.forkReseeds = reg.forkReseeds.load(std::memory_order_relaxed);
+    stats.failures = reg.failures.load(std::memory_order_relaxed);
+    stats.healthy = hasGoodQuality();
+    return stats;
 }
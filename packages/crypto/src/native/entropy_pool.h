@@ -3,9 +3,24 @@
 
 #include <vector>
 #include <cstddef>
-#include <mutex>
+#include <cstdint>
 #include <memory>
 
+struct EntropyStats
+{
+    uint64_t bytesGenerated{0};
+    uint64_t requests{0};
+    uint64_t instantiations{0}; // per-thread DRBGs seeded from the OS
+    uint64_t forkReseeds{0};    // DRBGs replaced after a fork()
+    uint64_t failures{0};       // instantiate / generate errors
+    bool healthy{false};
+};
+
+// Random bytes from a per-thread AES-256 CTR-DRBG. Each thread seeds its
+// own DRBG from the operating system on first use, so getBytes takes no
+// lock. OpenSSL reseeds the DRBGs from the OS on its usual request and
+// time limits. A fork() in the process makes every thread drop its DRBG
+// and seed a fresh one, so parent and child never share output.
 class EntropyPool
 {
 public:
@@ -13,11 +28,13 @@ public:
     ~EntropyPool();
 
     std::vector<uint8_t> getBytes(size_t length);
+    void fill(uint8_t *out, size_t length);
     bool hasGoodQuality() const;
+    EntropyStats stats() const;
 
 private:
     struct Implementation;
     std::unique_ptr<Implementation> pImpl;
 };
 
-#endif // ENTROPY_POOL_H
\ No newline at end of file
+#endif // ENTROPY_POOL_H
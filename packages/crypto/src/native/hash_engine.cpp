@@ -0,0 +1,229 @@
+#include "hash_engine.h"
+#include "keccak.h"
+#include <openssl/evp.h>
+#include <algorithm>
+#include <cstring>
+#include <numeric>
+#include <vector>
+
+namespace quantum
+{
+
+    namespace
+    {
+        struct KeccakParams
+        {
+            size_t rate;
+            uint8_t suffix;
+        };
+
+        KeccakParams keccakParams(HashAlgorithm algorithm)
+        {
+            switch (algorithm)
+            {
+            case HashAlgorithm::SHA3_256:
+                return {136, keccak::SHA3_SUFFIX};
+            case HashAlgorithm::SHA3_512:
+                return {72, keccak::SHA3_SUFFIX};
+            case HashAlgorithm::SHAKE128:
+                return {168, keccak::SHAKE_SUFFIX};
+            case HashAlgorithm::SHAKE256:
+                return {136, keccak::SHAKE_SUFFIX};
+            default:
+                throw MemoryError("Not a Keccak algorithm");
+            }
+        }
+
+        bool isXof(HashAlgorithm algorithm)
+        {
+            return algorithm == HashAlgorithm::SHAKE128 || algorithm == HashAlgorithm::SHAKE256;
+        }
+
+        void checkOutputLength(HashAlgorithm algorithm, size_t outputLength)
+        {
+            if (outputLength == 0 ||
+                (!isXof(algorithm) && outputLength != HashEngine::digestSize(algorithm)))
+            {
+                throw MemoryError("Invalid digest length for hash algorithm");
+            }
+        }
+
+        void sha256(const uint8_t *data, size_t length, uint8_t *out)
+        {
+            unsigned int written = 0;
+            if (EVP_Digest(data, length, out, &written, EVP_sha256(), nullptr) != 1)
+            {
+                throw MemoryError("SHA-256 computation failed");
+            }
+        }
+
+        // Hash up to four messages in lockstep. Every lane absorbs its own
+        // block count; a lane's state is handed to a scalar sponge for
+        // squeezing right after its final (padded) block is permuted.
+        void keccakX4(const KeccakParams &params, const uint8_t *const *data, const size_t *lengths,
+                      size_t lanes, uint8_t *const *out, size_t outputLength)
+        {
+            keccak::StateX4 state;
+            std::memset(&state, 0, sizeof(state));
+
+            size_t blocks[keccak::LANES] = {0, 0, 0, 0};
+            size_t maxBlocks = 0;
+            for (size_t l = 0; l < lanes; ++l)
+            {
+                blocks[l] = lengths[l] / params.rate + 1;
+                maxBlocks = std::max(maxBlocks, blocks[l]);
+            }
+
+            uint8_t padded[168];
+            for (size_t b = 0; b < maxBlocks; ++b)
+            {
+                for (size_t l = 0; l < lanes; ++l)
+                {
+                    if (b >= blocks[l])
+                    {
+                        continue;
+                    }
+
+                    const uint8_t *block = data[l] + b * params.rate;
+                    if (b + 1 == blocks[l])
+                    {
+                        size_t tail = lengths[l] - b * params.rate;
+                        std::memset(padded, 0, params.rate);
+                        if (tail > 0)
+                        {
+                            std::memcpy(padded, block, tail);
+                        }
+                        padded[tail] ^= params.suffix;
+                        padded[params.rate - 1] ^= 0x80;
+                        block = padded;
+                    }
+                    for (size_t w = 0; w < params.rate / 8; ++w)
+                    {
+                        state.words[w][l] ^= keccak::load64(block + 8 * w);
+                    }
+                }
+
+                keccak::permuteX4(state);
+
+                for (size_t l = 0; l < lanes; ++l)
+                {
+                    if (b + 1 != blocks[l])
+                    {
+                        continue;
+                    }
+                    uint64_t lane[keccak::STATE_WORDS];
+                    for (size_t i = 0; i < keccak::STATE_WORDS; ++i)
+                    {
+                        lane[i] = state.words[i][l];
+                    }
+                    keccak::Sponge sponge(params.rate, params.suffix);
+                    sponge.resumeSqueeze(lane);
+                    sponge.squeeze(out[l], outputLength);
+                }
+            }
+        }
+    }
+
+    size_t HashEngine::digestSize(HashAlgorithm algorithm)
+    {
+        switch (algorithm)
+        {
+        case HashAlgorithm::SHA3_256:
+        case HashAlgorithm::SHAKE128:
+        case HashAlgorithm::SHA256:
+            return 32;
+        case HashAlgorithm::SHA3_512:
+        case HashAlgorithm::SHAKE256:
+            return 64;
+        }
+        throw MemoryError("Unknown hash algorithm");
+    }
+
+    HashAlgorithm HashEngine::parse(const std::string &name)
+    {
+        if (name == "sha3-256")
+            return HashAlgorithm::SHA3_256;
+        if (name == "sha3-512")
+            return HashAlgorithm::SHA3_512;
+        if (name == "shake128")
+            return HashAlgorithm::SHAKE128;
+        if (name == "shake256")
+            return HashAlgorithm::SHAKE256;
+        if (name == "sha256")
+            return HashAlgorithm::SHA256;
+        throw MemoryError("Unknown hash algorithm");
+    }
+
+    void HashEngine::hash(HashAlgorithm algorithm, const uint8_t *data, size_t length,
+                          uint8_t *out, size_t outputLength)
+    {
+        checkOutputLength(algorithm, outputLength);
+        if (algorithm == HashAlgorithm::SHA256)
+        {
+            sha256(data, length, out);
+            return;
+        }
+
+        KeccakParams params = keccakParams(algorithm);
+        keccak::Sponge sponge(params.rate, params.suffix);
+        if (length > 0)
+        {
+            sponge.absorb(data, length);
+        }
+        sponge.squeeze(out, outputLength);
+    }
+
+    Buffer HashEngine::hash(HashAlgorithm algorithm, const Buffer &data, size_t outputLength)
+    {
+        if (outputLength == 0)
+        {
+            outputLength = digestSize(algorithm);
+        }
+        Buffer digest(outputLength);
+        hash(algorithm, data.data(), data.size(), digest.data(), outputLength);
+        return digest;
+    }
+
+    void HashEngine::hashBatch(HashAlgorithm algorithm, const uint8_t *const *data, const size_t *lengths,
+                               size_t count, uint8_t *out, size_t outputLength)
+    {
+        checkOutputLength(algorithm, outputLength);
+        if (algorithm == HashAlgorithm::SHA256 || !keccak::hasAvx2())
+        {
+            for (size_t i = 0; i < count; ++i)
+            {
+                hash(algorithm, data[i], lengths[i], out + i * outputLength, outputLength);
+            }
+            return;
+        }
+
+        // Group messages of similar length so that lanes finish together.
+        std::vector<size_t> order(count);
+        std::iota(order.begin(), order.end(), 0);
+        std::stable_sort(order.begin(), order.end(), [lengths](size_t a, size_t b)
+                         { return lengths[a] < lengths[b]; });
+
+        KeccakParams params = keccakParams(algorithm);
+        for (size_t i = 0; i < count; i += keccak::LANES)
+        {
+            size_t lanes = std::min(keccak::LANES, count - i);
+            const uint8_t *laneData[keccak::LANES];
+            size_t laneLengths[keccak::LANES];
+            uint8_t *laneOut[keccak::LANES];
+            for (size_t l = 0; l < lanes; ++l)
+            {
+                size_t index = order[i + l];
+                laneData[l] = data[index];
+                laneLengths[l] = lengths[index];
+                laneOut[l] = out + index * outputLength;
+            }
+            keccakX4(params, laneData, laneLengths, lanes, laneOut, outputLength);
+        }
+    }
+
+    const char *HashEngine::backend()
+    {
+        return keccak::hasAvx2() ? "avx2-x4" : "scalar";
+    }
+
+} // namespace quantum
@@ -0,0 +1,54 @@
+#ifndef HASH_ENGINE_H
+#define HASH_ENGINE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include "memory.h"
+
+namespace quantum
+{
+
+    enum class HashAlgorithm
+    {
+        SHA3_256,
+        SHA3_512,
+        SHAKE128,
+        SHAKE256,
+        SHA256
+    };
+
+    // Native hashing for the JS layer (dilithiumHash / kyberHash / hash and
+    // batch hashing of transaction ids and merkle leaves).
+    //
+    // The Keccak family runs on our own sponge. Batches are hashed four
+    // messages per pass with the AVX2 Keccak kernel when the CPU supports it
+    // (selected at runtime), and one at a time otherwise. SHA-256 goes
+    // through OpenSSL, which already uses the SHA extensions where present.
+    class HashEngine
+    {
+    public:
+        // Natural digest size; SHAKE128/256 default to 32/64 bytes.
+        static size_t digestSize(HashAlgorithm algorithm);
+
+        // Parse "sha3-256", "sha3-512", "shake128", "shake256" or "sha256".
+        static HashAlgorithm parse(const std::string &name);
+
+        // Output length must equal digestSize() except for the SHAKE XOFs,
+        // which accept any non-zero length.
+        static void hash(HashAlgorithm algorithm, const uint8_t *data, size_t length,
+                         uint8_t *out, size_t outputLength);
+        static Buffer hash(HashAlgorithm algorithm, const Buffer &data, size_t outputLength = 0);
+
+        // Hash count independent messages; digest i is written to
+        // out + i * outputLength.
+        static void hashBatch(HashAlgorithm algorithm, const uint8_t *const *data, const size_t *lengths,
+                              size_t count, uint8_t *out, size_t outputLength);
+
+        // "avx2-x4" or "scalar"
+        static const char *backend();
+    };
+
+} // namespace quantum
+
+#endif // HASH_ENGINE_H
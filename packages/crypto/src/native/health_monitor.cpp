@@ -0,0 +1,116 @@
+#include "health_monitor.h"
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+namespace quantum
+{
+
+    struct HealthMonitor::Implementation
+    {
+        Check check;
+        std::chrono::milliseconds interval;
+        std::atomic<uint32_t> failures{HEALTH_PENDING};
+        std::atomic<uint64_t> runs{0};
+        std::atomic<int64_t> lastRunMillis{0};
+        std::atomic<uint64_t> lastDurationMicros{0};
+        // Serializes on-demand runs with the background thread; never taken
+        // by readers
+        std::mutex runMutex;
+        std::mutex stopMutex;
+        std::condition_variable stopped;
+        bool stopping{false};
+        std::thread worker;
+
+        uint32_t run()
+        {
+            std::lock_guard<std::mutex> lock(runMutex);
+            auto start = std::chrono::steady_clock::now();
+            uint32_t result;
+            try
+            {
+                result = check();
+            }
+            catch (const std::exception &)
+            {
+                // A check that cannot even run is not a pass
+                result = HEALTH_MONITOR;
+            }
+            auto elapsed = std::chrono::steady_clock::now() - start;
+
+            lastDurationMicros.store(
+                static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(elapsed).count()),
+                std::memory_order_relaxed);
+            lastRunMillis.store(
+                std::chrono::duration_cast<std::chrono::milliseconds>(
+                    std::chrono::system_clock::now().time_since_epoch())
+                    .count(),
+                std::memory_order_relaxed);
+            runs.fetch_add(1, std::memory_order_relaxed);
+            failures.store(result, std::memory_order_release);
+            return result;
+        }
+
+        void loop()
+        {
+            for (;;)
+            {
+                run();
+                std::unique_lock<std::mutex> lock(stopMutex);
+                if (stopped.wait_for(lock, interval, [this]()
+                                     { return stopping; }))
+                {
+                    return;
+                }
+            }
+        }
+    };
+
+    HealthMonitor::HealthMonitor(Check check, uint32_t intervalMillis)
+        : pImpl(std::make_unique<Implementation>())
+    {
+        pImpl->check = std::move(check);
+        pImpl->interval = std::chrono::milliseconds(intervalMillis);
+        if (intervalMillis > 0)
+        {
+            pImpl->worker = std::thread([impl = pImpl.get()]()
+                                        { impl->loop(); });
+        }
+    }
+
+    HealthMonitor::~HealthMonitor()
+    {
+        {
+            std::lock_guard<std::mutex> lock(pImpl->stopMutex);
+            pImpl->stopping = true;
+        }
+        pImpl->stopped.notify_all();
+        if (pImpl->worker.joinable())
+        {
+            pImpl->worker.join();
+        }
+    }
+
+    uint32_t HealthMonitor::run()
+    {
+        return pImpl->run();
+    }
+
+    uint32_t HealthMonitor::failures() const
+    {
+        return pImpl->failures.load(std::memory_order_acquire);
+    }
+
+    HealthStatus HealthMonitor::status() const
+    {
+        HealthStatus status;
+        status.failures = pImpl->failures.load(std::memory_order_acquire);
+        status.runs = pImpl->runs.load(std::memory_order_relaxed);
+        status.lastRunMillis = pImpl->lastRunMillis.load(std::memory_order_relaxed);
+        status.lastDurationMicros = pImpl->lastDurationMicros.load(std::memory_order_relaxed);
+        return status;
+    }
+
+} // namespace quantum
@@ -0,0 +1,61 @@
+#ifndef HEALTH_MONITOR_H
+#define HEALTH_MONITOR_H
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+
+namespace quantum
+{
+
+    // Bits of the health status word. 0 means the last run passed every
+    // check; per-parameter-set bits are shifted by the set's index.
+    enum HealthFailure : uint32_t
+    {
+        HEALTH_SIGNATURE = 1u << 0, // + SecurityLevel
+        HEALTH_KEM = 1u << 4,       // + SecurityLevel
+        HEALTH_FALCON = 1u << 8,    // + FalconVariant
+        HEALTH_HASH = 1u << 10,
+        HEALTH_ENTROPY = 1u << 11,
+        HEALTH_MONITOR = 1u << 12, // security level or side-channel flag raised
+        HEALTH_PENDING = 1u << 31, // no run has completed yet
+    };
+
+    struct HealthStatus
+    {
+        uint32_t failures{HEALTH_PENDING};
+        uint64_t runs{0};
+        int64_t lastRunMillis{0}; // Unix time of the last completed run
+        uint64_t lastDurationMicros{0};
+    };
+
+    // Runs a check function on its own thread every interval and publishes
+    // the result in atomics, so readers never wait on the check or on any
+    // lock the crypto hot path uses.
+    class HealthMonitor
+    {
+    public:
+        // Returns a HealthFailure mask.
+        using Check = std::function<uint32_t()>;
+
+        // An interval of 0 starts no thread; run() still works on demand.
+        HealthMonitor(Check check, uint32_t intervalMillis);
+        ~HealthMonitor();
+
+        HealthMonitor(const HealthMonitor &) = delete;
+        HealthMonitor &operator=(const HealthMonitor &) = delete;
+
+        // Run the check on the calling thread and publish the result.
+        uint32_t run();
+        uint32_t failures() const;
+        HealthStatus status() const;
+
+    private:
+        struct Implementation;
+        std::unique_ptr<Implementation> pImpl;
+    };
+
+} // namespace quantum
+
+#endif // HEALTH_MONITOR_H
@@ -0,0 +1,80 @@
+#include "hybrid_hash.h"
+#include "hash_engine.h"
+#include "keccak.h"
+#include <cstring>
+#include <vector>
+
+namespace quantum
+{
+
+    namespace
+    {
+        const char SHA3_TAG[] = "H3Tag/HybridHash/v1/SHA3-512";
+        const char SHAKE_TAG[] = "H3Tag/HybridHash/v1/SHAKE256";
+
+        constexpr size_t SHA3_512_RATE = 72;
+        constexpr size_t INNER_SIZE = 64;
+        constexpr size_t SHAKE_TAG_SIZE = sizeof(SHAKE_TAG) - 1;
+        // Input of the second stage: SHAKE_TAG || inner
+        constexpr size_t OUTER_SIZE = SHAKE_TAG_SIZE + INNER_SIZE;
+
+        // Writes SHAKE_TAG || SHA3-512(SHA3_TAG || LE64(len) || data) to
+        // outer. The first stage streams the caller's bytes through the
+        // sponge so they are never copied.
+        void innerStage(const uint8_t *data, size_t length, uint8_t *outer)
+        {
+            uint8_t encodedLength[8];
+            keccak::store64(encodedLength, static_cast<uint64_t>(length));
+
+            keccak::Sponge sponge(SHA3_512_RATE, keccak::SHA3_SUFFIX);
+            sponge.absorb(reinterpret_cast<const uint8_t *>(SHA3_TAG), sizeof(SHA3_TAG) - 1);
+            sponge.absorb(encodedLength, sizeof(encodedLength));
+            if (length != 0)
+            {
+                sponge.absorb(data, length);
+            }
+            sponge.finalize();
+
+            std::memcpy(outer, SHAKE_TAG, SHAKE_TAG_SIZE);
+            sponge.squeeze(outer + SHAKE_TAG_SIZE, INNER_SIZE);
+        }
+    }
+
+    void HybridHash::hash(const uint8_t *data, size_t length, uint8_t *out)
+    {
+        uint8_t outer[OUTER_SIZE];
+        innerStage(data, length, outer);
+        HashEngine::hash(HashAlgorithm::SHAKE256, outer, sizeof(outer), out, DIGEST_SIZE);
+        secureZero(outer, sizeof(outer));
+    }
+
+    Buffer HybridHash::hash(const Buffer &data)
+    {
+        Buffer digest(DIGEST_SIZE);
+        hash(data.data(), data.size(), digest.data());
+        return digest;
+    }
+
+    void HybridHash::hashBatch(const uint8_t *const *data, const size_t *lengths, size_t count, uint8_t *out)
+    {
+        if (count == 0)
+        {
+            return;
+        }
+
+        // The second stage has a fixed-size input, so the whole batch goes
+        // through HashEngine's multi-buffer SHAKE256 in one call.
+        std::vector<uint8_t> outer(count * OUTER_SIZE);
+        std::vector<const uint8_t *> inputs(count);
+        std::vector<size_t> sizes(count, OUTER_SIZE);
+        for (size_t i = 0; i < count; ++i)
+        {
+            innerStage(data[i], lengths[i], outer.data() + i * OUTER_SIZE);
+            inputs[i] = outer.data() + i * OUTER_SIZE;
+        }
+
+        HashEngine::hashBatch(HashAlgorithm::SHAKE256, inputs.data(), sizes.data(), count, out, DIGEST_SIZE);
+        secureZero(outer.data(), outer.size());
+    }
+
+} // namespace quantum
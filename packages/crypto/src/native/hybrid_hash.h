@@ -0,0 +1,36 @@
+#ifndef HYBRID_HASH_H
+#define HYBRID_HASH_H
+
+#include <cstddef>
+#include <cstdint>
+#include "memory.h"
+
+namespace quantum
+{
+
+    // Keyless, deterministic 512-bit hash used wherever the JS layer needs a
+    // "hybrid" digest (message checksums, block and template hashes).
+    //
+    //   inner  = SHA3-512("H3Tag/HybridHash/v1/SHA3-512" || LE64(len) || data)
+    //   digest = SHAKE256("H3Tag/HybridHash/v1/SHAKE256" || inner, 64)
+    //
+    // Both stages carry their own domain-separation tag so the output can
+    // never collide with a plain SHA3 or SHAKE digest of the same bytes.
+    class HybridHash
+    {
+    public:
+        static constexpr size_t DIGEST_SIZE = 64;
+
+        // out must have room for DIGEST_SIZE bytes. data may be null when
+        // length is zero.
+        static void hash(const uint8_t *data, size_t length, uint8_t *out);
+        static Buffer hash(const Buffer &data);
+
+        // Hash count independent inputs; digest i is written to
+        // out + i * DIGEST_SIZE.
+        static void hashBatch(const uint8_t *const *data, const size_t *lengths, size_t count, uint8_t *out);
+    };
+
+} // namespace quantum
+
+#endif // HYBRID_HASH_H
@@ -0,0 +1,281 @@
+#include "keccak.h"
+#include <cstring>
+
+// Define QUANTUM_KECCAK_SCALAR to build without the AVX2 kernel.
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__)) && !defined(QUANTUM_KECCAK_SCALAR)
+#define QUANTUM_KECCAK_AVX2 1
+#include <immintrin.h>
+#endif
+
+namespace quantum
+{
+    namespace keccak
+    {
+
+        namespace
+        {
+            const uint64_t ROUND_CONSTANTS[24] = {
+                0x0000000000000001ULL, 0x0000000000008082ULL, 0x800000000000808aULL,
+                0x8000000080008000ULL, 0x000000000000808bULL, 0x0000000080000001ULL,
+                0x8000000080008081ULL, 0x8000000000008009ULL, 0x000000000000008aULL,
+                0x0000000000000088ULL, 0x0000000080008009ULL, 0x000000008000000aULL,
+                0x000000008000808bULL, 0x800000000000008bULL, 0x8000000000008089ULL,
+                0x8000000000008003ULL, 0x8000000000008002ULL, 0x8000000000000080ULL,
+                0x000000000000800aULL, 0x800000008000000aULL, 0x8000000080008081ULL,
+                0x8000000000008080ULL, 0x0000000080000001ULL, 0x8000000080008008ULL};
+
+            // Combined rho rotation offsets and pi lane order
+            const unsigned ROTATIONS[24] = {1, 3, 6, 10, 15, 21, 28, 36, 45, 55, 2, 14,
+                                            27, 41, 56, 8, 25, 43, 62, 18, 39, 61, 20, 44};
+            const unsigned PI_LANES[24] = {10, 7, 11, 17, 18, 3, 5, 16, 8, 21, 24, 4,
+                                           15, 23, 19, 13, 12, 2, 20, 14, 22, 9, 6, 1};
+
+            inline uint64_t rotl(uint64_t value, unsigned shift)
+            {
+                return (value << shift) | (value >> (64 - shift));
+            }
+
+#ifdef QUANTUM_KECCAK_AVX2
+            // AVX2 has no 64-bit rotate; build it from two shifts.
+#define KECCAK_ROTL_X4(v, n) _mm256_or_si256(_mm256_slli_epi64((v), (n)), _mm256_srli_epi64((v), 64 - (n)))
+
+            __attribute__((target("avx2"))) void permuteAvx2(StateX4 &state)
+            {
+                __m256i a[STATE_WORDS];
+                __m256i c[5];
+                for (size_t i = 0; i < STATE_WORDS; ++i)
+                {
+                    a[i] = _mm256_load_si256(reinterpret_cast<const __m256i *>(state.words[i]));
+                }
+
+                for (int round = 0; round < 24; ++round)
+                {
+                    // Theta
+                    for (int x = 0; x < 5; ++x)
+                    {
+                        c[x] = _mm256_xor_si256(_mm256_xor_si256(a[x], a[x + 5]),
+                                                _mm256_xor_si256(_mm256_xor_si256(a[x + 10], a[x + 15]), a[x + 20]));
+                    }
+                    for (int x = 0; x < 5; ++x)
+                    {
+                        __m256i d = _mm256_xor_si256(c[(x + 4) % 5], KECCAK_ROTL_X4(c[(x + 1) % 5], 1));
+                        for (int y = 0; y < 25; y += 5)
+                        {
+                            a[y + x] = _mm256_xor_si256(a[y + x], d);
+                        }
+                    }
+
+                    // Rho and pi
+                    __m256i carry = a[1];
+                    for (int i = 0; i < 24; ++i)
+                    {
+                        unsigned lane = PI_LANES[i];
+                        __m256i next = a[lane];
+                        __m256i shift = _mm256_set1_epi64x(ROTATIONS[i]);
+                        __m256i back = _mm256_set1_epi64x(64 - ROTATIONS[i]);
+                        a[lane] = _mm256_or_si256(_mm256_sllv_epi64(carry, shift), _mm256_srlv_epi64(carry, back));
+                        carry = next;
+                    }
+
+                    // Chi
+                    for (int y = 0; y < 25; y += 5)
+                    {
+                        for (int x = 0; x < 5; ++x)
+                        {
+                            c[x] = a[y + x];
+                        }
+                        for (int x = 0; x < 5; ++x)
+                        {
+                            a[y + x] = _mm256_xor_si256(c[x], _mm256_andnot_si256(c[(x + 1) % 5], c[(x + 2) % 5]));
+                        }
+                    }
+
+                    // Iota
+                    a[0] = _mm256_xor_si256(a[0], _mm256_set1_epi64x(static_cast<long long>(ROUND_CONSTANTS[round])));
+                }
+
+                for (size_t i = 0; i < STATE_WORDS; ++i)
+                {
+                    _mm256_store_si256(reinterpret_cast<__m256i *>(state.words[i]), a[i]);
+                }
+            }
+
+#undef KECCAK_ROTL_X4
+
+            bool detectAvx2()
+            {
+                __builtin_cpu_init();
+                return __builtin_cpu_supports("avx2");
+            }
+#endif
+        }
+
+        void permute(uint64_t state[STATE_WORDS])
+        {
+            uint64_t c[5];
+            for (int round = 0; round < 24; ++round)
+            {
+                // Theta
+                for (int x = 0; x < 5; ++x)
+                {
+                    c[x] = state[x] ^ state[x + 5] ^ state[x + 10] ^ state[x + 15] ^ state[x + 20];
+                }
+                for (int x = 0; x < 5; ++x)
+                {
+                    uint64_t d = c[(x + 4) % 5] ^ rotl(c[(x + 1) % 5], 1);
+                    for (int y = 0; y < 25; y += 5)
+                    {
+                        state[y + x] ^= d;
+                    }
+                }
+
+                // Rho and pi
+                uint64_t carry = state[1];
+                for (int i = 0; i < 24; ++i)
+                {
+                    unsigned lane = PI_LANES[i];
+                    uint64_t next = state[lane];
+                    state[lane] = rotl(carry, ROTATIONS[i]);
+                    carry = next;
+                }
+
+                // Chi
+                for (int y = 0; y < 25; y += 5)
+                {
+                    for (int x = 0; x < 5; ++x)
+                    {
+                        c[x] = state[y + x];
+                    }
+                    for (int x = 0; x < 5; ++x)
+                    {
+                        state[y + x] = c[x] ^ (~c[(x + 1) % 5] & c[(x + 2) % 5]);
+                    }
+                }
+
+                // Iota
+                state[0] ^= ROUND_CONSTANTS[round];
+            }
+        }
+
+        bool hasAvx2()
+        {
+#ifdef QUANTUM_KECCAK_AVX2
+            static const bool supported = detectAvx2();
+            return supported;
+#else
+            return false;
+#endif
+        }
+
+        void permuteX4(StateX4 &state)
+        {
+#ifdef QUANTUM_KECCAK_AVX2
+            if (hasAvx2())
+            {
+                permuteAvx2(state);
+                return;
+            }
+#endif
+            uint64_t lane[STATE_WORDS];
+            for (size_t l = 0; l < LANES; ++l)
+            {
+                for (size_t i = 0; i < STATE_WORDS; ++i)
+                {
+                    lane[i] = state.words[i][l];
+                }
+                permute(lane);
+                for (size_t i = 0; i < STATE_WORDS; ++i)
+                {
+                    state.words[i][l] = lane[i];
+                }
+            }
+        }
+
+        Sponge::Sponge(size_t rate, uint8_t suffix)
+            : rate_(rate), offset_(0), suffix_(suffix), squeezing_(false)
+        {
+            std::memset(state_, 0, sizeof(state_));
+        }
+
+        void Sponge::xorByte(size_t position, uint8_t value)
+        {
+            state_[position / 8] ^= static_cast<uint64_t>(value) << (8 * (position % 8));
+        }
+
+        void Sponge::absorb(const uint8_t *data, size_t length)
+        {
+            // Finish a partially filled block byte by byte
+            while (length > 0 && offset_ % 8 != 0)
+            {
+                xorByte(offset_++, *data++);
+                --length;
+                if (offset_ == rate_)
+                {
+                    permute(state_);
+                    offset_ = 0;
+                }
+            }
+
+            // Whole words, then whole blocks
+            while (length >= 8)
+            {
+                state_[offset_ / 8] ^= load64(data);
+                offset_ += 8;
+                data += 8;
+                length -= 8;
+                if (offset_ == rate_)
+                {
+                    permute(state_);
+                    offset_ = 0;
+                }
+            }
+
+            while (length > 0)
+            {
+                xorByte(offset_++, *data++);
+                --length;
+                if (offset_ == rate_)
+                {
+                    permute(state_);
+                    offset_ = 0;
+                }
+            }
+        }
+
+        void Sponge::finalize()
+        {
+            xorByte(offset_, suffix_);
+            xorByte(rate_ - 1, 0x80);
+            permute(state_);
+            offset_ = 0;
+            squeezing_ = true;
+        }
+
+        void Sponge::squeeze(uint8_t *out, size_t length)
+        {
+            if (!squeezing_)
+            {
+                finalize();
+            }
+            while (length > 0)
+            {
+                if (offset_ == rate_)
+                {
+                    permute(state_);
+                    offset_ = 0;
+                }
+                *out++ = static_cast<uint8_t>(state_[offset_ / 8] >> (8 * (offset_ % 8)));
+                ++offset_;
+                --length;
+            }
+        }
+
+        void Sponge::resumeSqueeze(const uint64_t state[STATE_WORDS])
+        {
+            std::memcpy(state_, state, sizeof(state_));
+            offset_ = 0;
+            squeezing_ = true;
+        }
+
+    } // namespace keccak
+} // namespace quantum
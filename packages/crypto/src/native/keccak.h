@@ -0,0 +1,86 @@
+#ifndef KECCAK_H
+#define KECCAK_H
+
+#include <cstddef>
+#include <cstdint>
+
+namespace quantum
+{
+    namespace keccak
+    {
+
+        constexpr size_t STATE_WORDS = 25;
+        constexpr size_t LANES = 4;
+
+        // Domain-separation suffixes (FIPS 202)
+        constexpr uint8_t SHA3_SUFFIX = 0x06;
+        constexpr uint8_t SHAKE_SUFFIX = 0x1F;
+
+        // Four independent Keccak states laid out word-major so that word i
+        // of all lanes sits in one 256-bit vector: words[i][lane].
+        struct alignas(32) StateX4
+        {
+            uint64_t words[STATE_WORDS][LANES];
+        };
+
+        // Keccak-f[1600] on a single state.
+        void permute(uint64_t state[STATE_WORDS]);
+
+        // Keccak-f[1600] on four states at once. Uses AVX2 when the CPU
+        // supports it and falls back to four scalar permutations otherwise.
+        void permuteX4(StateX4 &state);
+
+        // True when permuteX4 runs the AVX2 kernel.
+        bool hasAvx2();
+
+        inline uint64_t load64(const uint8_t *bytes)
+        {
+            uint64_t value = 0;
+            for (int i = 7; i >= 0; --i)
+            {
+                value = (value << 8) | bytes[i];
+            }
+            return value;
+        }
+
+        inline void store64(uint8_t *bytes, uint64_t value)
+        {
+            for (int i = 0; i < 8; ++i)
+            {
+                bytes[i] = static_cast<uint8_t>(value >> (8 * i));
+            }
+        }
+
+        // Byte-oriented sponge over a single state.
+        class Sponge
+        {
+        public:
+            Sponge(size_t rate, uint8_t suffix);
+
+            void absorb(const uint8_t *data, size_t length);
+            // Apply padding and switch to squeezing.
+            void finalize();
+            void squeeze(uint8_t *out, size_t length);
+
+            // Resume squeezing from a state that has already been padded and
+            // permuted (used to hand a finished SIMD lane back to scalar code).
+            void resumeSqueeze(const uint64_t state[STATE_WORDS]);
+
+            const uint64_t *state() const { return state_; }
+            size_t rate() const { return rate_; }
+            size_t offset() const { return offset_; }
+
+        private:
+            void xorByte(size_t position, uint8_t value);
+
+            uint64_t state_[STATE_WORDS];
+            size_t rate_;
+            size_t offset_;
+            uint8_t suffix_;
+            bool squeezing_;
+        };
+
+    } // namespace keccak
+} // namespace quantum
+
+#endif // KECCAK_H
@@ -0,0 +1,47 @@
+#include "key_registry.h"
+#include <mutex>
+
+namespace quantum
+{
+
+    namespace
+    {
+        struct ZeroizingDelete
+        {
+            void operator()(KeyRegistry::Entry *entry) const
+            {
+                entry->key.zeroize();
+                delete entry;
+            }
+        };
+    }
+
+    KeyRegistry::Handle KeyRegistry::add(PrivateKey &&key, SecurityLevel level, KeyAlgorithm algorithm)
+    {
+        std::shared_ptr<const Entry> entry(new Entry{std::move(key), level, algorithm}, ZeroizingDelete());
+        std::unique_lock<std::shared_mutex> lock(mutex_);
+        Handle handle = next_++;
+        keys_.emplace(handle, std::move(entry));
+        return handle;
+    }
+
+    std::shared_ptr<const KeyRegistry::Entry> KeyRegistry::get(Handle handle) const
+    {
+        std::shared_lock<std::shared_mutex> lock(mutex_);
+        auto it = keys_.find(handle);
+        return it == keys_.end() ? nullptr : it->second;
+    }
+
+    bool KeyRegistry::remove(Handle handle)
+    {
+        std::unique_lock<std::shared_mutex> lock(mutex_);
+        return keys_.erase(handle) > 0;
+    }
+
+    size_t KeyRegistry::size() const
+    {
+        std::shared_lock<std::shared_mutex> lock(mutex_);
+        return keys_.size();
+    }
+
+} // namespace quantum
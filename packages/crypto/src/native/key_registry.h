@@ -0,0 +1,47 @@
+#ifndef KEY_REGISTRY_H
+#define KEY_REGISTRY_H
+
+#include "memory.h"
+#include <cstdint>
+#include <memory>
+#include <shared_mutex>
+#include <unordered_map>
+
+namespace quantum
+{
+
+    enum class SecurityLevel : uint32_t; // quantum.h
+    enum class KeyAlgorithm : uint32_t;  // quantum.h
+
+    // Private keys held natively in secure memory and referred to by opaque
+    // handles, so hot signing and decapsulation paths never marshal key
+    // bytes through JS.
+    // Lookups hand out shared ownership, so unloading a key while a signature
+    // is in flight is safe; the bytes are zeroed when the last user is done.
+    class KeyRegistry
+    {
+    public:
+        using Handle = uint64_t;
+
+        struct Entry
+        {
+            PrivateKey key;
+            SecurityLevel level;
+            KeyAlgorithm algorithm;
+        };
+
+        Handle add(PrivateKey &&key, SecurityLevel level, KeyAlgorithm algorithm);
+        std::shared_ptr<const Entry> get(Handle handle) const;
+        bool remove(Handle handle);
+        size_t size() const;
+
+    private:
+        mutable std::shared_mutex mutex_;
+        std::unordered_map<Handle, std::shared_ptr<const Entry>> keys_;
+        // Handles are never reused; 0 is never issued
+        Handle next_{1};
+    };
+
+} // namespace quantum
+
+#endif // KEY_REGISTRY_H
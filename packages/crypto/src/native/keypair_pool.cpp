@@ -0,0 +1,152 @@
+#include "keypair_pool.h"
+#include "quantum.h"
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <optional>
+#include <thread>
+
+#ifdef __linux__
+#include <sys/resource.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace quantum
+{
+
+    namespace
+    {
+        // Run the refill thread at the lowest scheduling priority so it only
+        // uses otherwise idle CPU. Linux applies nice values per thread.
+        void lowerThreadPriority()
+        {
+#ifdef __linux__
+            setpriority(PRIO_PROCESS, static_cast<id_t>(syscall(SYS_gettid)), 19);
+#endif
+        }
+    }
+
+    struct KeyPairPool::Implementation
+    {
+        std::string algorithm;
+        Generator generate;
+        mutable std::mutex mutex;
+        std::condition_variable refill;
+        std::deque<KeyPair> ready;
+        size_t depth;
+        bool stopping{false};
+        std::atomic<uint64_t> hits{0};
+        std::atomic<uint64_t> misses{0};
+        std::atomic<uint64_t> generated{0};
+        std::thread worker;
+
+        void run()
+        {
+            lowerThreadPriority();
+            std::unique_lock<std::mutex> lock(mutex);
+            for (;;)
+            {
+                refill.wait(lock, [this]()
+                            { return stopping || ready.size() < depth; });
+                if (stopping)
+                {
+                    return;
+                }
+
+                lock.unlock();
+                std::optional<KeyPair> keyPair;
+                try
+                {
+                    keyPair.emplace(generate());
+                }
+                catch (const std::exception &)
+                {
+                    // Failures are logged by QuantumCrypto; retry later
+                }
+                lock.lock();
+
+                if (!keyPair)
+                {
+                    refill.wait_for(lock, std::chrono::seconds(1), [this]()
+                                    { return stopping; });
+                    continue;
+                }
+                if (ready.size() < depth)
+                {
+                    ready.push_back(std::move(*keyPair));
+                    generated.fetch_add(1, std::memory_order_relaxed);
+                }
+            }
+        }
+    };
+
+    KeyPairPool::KeyPairPool(std::string algorithm, Generator generate, size_t depth)
+        : pImpl(std::make_unique<Implementation>())
+    {
+        pImpl->algorithm = std::move(algorithm);
+        pImpl->generate = std::move(generate);
+        pImpl->depth = depth;
+        pImpl->worker = std::thread([impl = pImpl.get()]()
+                                    { impl->run(); });
+    }
+
+    KeyPairPool::~KeyPairPool()
+    {
+        {
+            std::lock_guard<std::mutex> lock(pImpl->mutex);
+            pImpl->stopping = true;
+        }
+        pImpl->refill.notify_all();
+        pImpl->worker.join();
+    }
+
+    KeyPair KeyPairPool::take()
+    {
+        {
+            std::lock_guard<std::mutex> lock(pImpl->mutex);
+            if (!pImpl->ready.empty())
+            {
+                KeyPair keyPair = std::move(pImpl->ready.front());
+                pImpl->ready.pop_front();
+                pImpl->hits.fetch_add(1, std::memory_order_relaxed);
+                pImpl->refill.notify_one();
+                return keyPair;
+            }
+        }
+        pImpl->misses.fetch_add(1, std::memory_order_relaxed);
+        pImpl->refill.notify_one();
+        return pImpl->generate();
+    }
+
+    void KeyPairPool::setDepth(size_t depth)
+    {
+        {
+            std::lock_guard<std::mutex> lock(pImpl->mutex);
+            pImpl->depth = depth;
+            while (pImpl->ready.size() > depth)
+            {
+                pImpl->ready.pop_back();
+            }
+        }
+        pImpl->refill.notify_one();
+    }
+
+    KeyPoolStats KeyPairPool::stats() const
+    {
+        KeyPoolStats stats;
+        stats.algorithm = pImpl->algorithm;
+        {
+            std::lock_guard<std::mutex> lock(pImpl->mutex);
+            stats.depth = pImpl->depth;
+            stats.available = pImpl->ready.size();
+        }
+        stats.hits = pImpl->hits.load(std::memory_order_relaxed);
+        stats.misses = pImpl->misses.load(std::memory_order_relaxed);
+        stats.generated = pImpl->generated.load(std::memory_order_relaxed);
+        return stats;
+    }
+
+} // namespace quantum
@@ -0,0 +1,51 @@
+#ifndef KEYPAIR_POOL_H
+#define KEYPAIR_POOL_H
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+
+namespace quantum
+{
+
+    struct KeyPair; // quantum.h
+
+    struct KeyPoolStats
+    {
+        std::string algorithm;
+        size_t depth{0};
+        size_t available{0};
+        uint64_t hits{0};      // take() served from the pool
+        uint64_t misses{0};    // take() fell back to on-demand generation
+        uint64_t generated{0}; // key pairs produced by the background thread
+    };
+
+    // Key pairs pre-generated by a low-priority background thread, so
+    // callers on the request path take a ready key pair instead of paying
+    // keygen latency. The thread refills the pool up to depth whenever it
+    // drops below it; an empty pool falls back to generating on the caller.
+    class KeyPairPool
+    {
+    public:
+        using Generator = std::function<KeyPair()>;
+
+        KeyPairPool(std::string algorithm, Generator generate, size_t depth);
+        ~KeyPairPool();
+
+        KeyPairPool(const KeyPairPool &) = delete;
+        KeyPairPool &operator=(const KeyPairPool &) = delete;
+
+        KeyPair take();
+        void setDepth(size_t depth);
+        KeyPoolStats stats() const;
+
+    private:
+        struct Implementation;
+        std::unique_ptr<Implementation> pImpl;
+    };
+
+} // namespace quantum
+
+#endif // KEYPAIR_POOL_H
@@ -4,13 +4,16 @@
 #include <type_traits>
 #include <stdexcept>
 #include <cstring>
+#include <limits>
 #include <memory>
 #include <string>
+#include <utility>
 #include <vector>
 #include <openssl/sha.h>
 #include <openssl/bio.h>
 #include <openssl/buffer.h>
 #include <openssl/evp.h>
+#include "secure_arena.h"
 
 namespace quantum
 {
@@ -36,14 +39,59 @@ namespace quantum
         OPENSSL_cleanse(ptr, length);
     }
 
+    // Non-owning view of caller memory, standing in for C++20 std::span.
+    // Views are what the allocation-free QuantumCrypto overloads take, so a
+    // Buffer, a std::vector or a raw pointer and length all pass as is.
+    template <typename T>
+    class Span
+    {
+    public:
+        constexpr Span() noexcept = default;
+        constexpr Span(T *data, size_t size) noexcept : data_(data), size_(size) {}
+
+        // Any contiguous container whose data() converts to T *. Temporaries
+        // are accepted: they outlive the call the view is passed to.
+        template <typename Container,
+                  typename = std::enable_if_t<
+                      std::is_convertible<decltype(std::declval<Container &>().data()), T *>::value>>
+        constexpr Span(Container &&container) noexcept
+            : data_(container.data()), size_(container.size()) {}
+
+        constexpr T *data() const noexcept { return data_; }
+        constexpr size_t size() const noexcept { return size_; }
+        constexpr bool empty() const noexcept { return size_ == 0; }
+
+        constexpr Span subspan(size_t offset, size_t count) const noexcept
+        {
+            return Span(data_ + offset, count);
+        }
+
+    private:
+        T *data_{nullptr};
+        size_t size_{0};
+    };
+
+    using ByteSpan = Span<const uint8_t>;
+    using MutableByteSpan = Span<uint8_t>;
+
+    // Where a SecureBuffer's memory comes from. The secure heap is small and
+    // fixed in size, so only secrets (private keys, shared secrets) are
+    // placed there; public keys, signatures, ciphertexts, digests and batch
+    // outputs use the ordinary heap.
+    enum class MemoryKind
+    {
+        SECURE,
+        ORDINARY
+    };
+
     // Template class for secure buffer management
     template <typename T>
     class SecureBuffer
     {
     public:
         // Constructor
-        explicit SecureBuffer(size_t size)
-            : size_(size), data_(nullptr)
+        explicit SecureBuffer(size_t size, MemoryKind kind = MemoryKind::SECURE)
+            : size_(size), data_(nullptr), kind_(kind)
         {
             if (size_ == 0)
             {
@@ -56,21 +104,18 @@ namespace quantum
                 throw MemoryError("Requested buffer size is too large");
             }
 
-            data_ = static_cast<T *>(OPENSSL_secure_malloc(size_ * sizeof(T)));
+            data_ = static_cast<T *>(kind_ == MemoryKind::SECURE ? SecureArena::allocate(size_ * sizeof(T))
+                                                                 : OPENSSL_malloc(size_ * sizeof(T)));
             if (!data_)
             {
-                throw MemoryError("Secure memory allocation failed");
+                throw MemoryError("Memory allocation failed");
             }
         }
 
         // Destructor
         ~SecureBuffer()
         {
-            if (data_)
-            {
-                secureZero(data_, size_ * sizeof(T));
-                OPENSSL_secure_free(data_);
-            }
+            release();
         }
 
         // Delete copy constructor and copy assignment
@@ -79,7 +124,7 @@ namespace quantum
 
         // Move constructor
         SecureBuffer(SecureBuffer &&other) noexcept
-            : size_(other.size_), data_(other.data_)
+            : size_(other.size_), data_(other.data_), kind_(other.kind_)
         {
             other.data_ = nullptr;
             other.size_ = 0;
@@ -91,14 +136,11 @@ namespace quantum
             if (this != &other)
             {
                 // Free existing resources
-                if (data_)
-                {
-                    secureZero(data_, size_ * sizeof(T));
-                    OPENSSL_secure_free(data_);
-                }
+                release();
                 // Transfer ownership
                 data_ = other.data_;
                 size_ = other.size_;
+                kind_ = other.kind_;
                 other.data_ = nullptr;
                 other.size_ = 0;
             }
@@ -109,6 +151,7 @@ namespace quantum
         T *data() { return data_; }
         const T *data() const { return data_; }
         size_t size() const { return size_; }
+        MemoryKind kind() const { return kind_; }
 
         // Secure comparison
         bool equals(const SecureBuffer &other) const
@@ -128,8 +171,26 @@ namespace quantum
         }
 
     private:
+        void release()
+        {
+            if (!data_)
+            {
+                return;
+            }
+            secureZero(data_, size_ * sizeof(T));
+            if (kind_ == MemoryKind::SECURE)
+            {
+                SecureArena::deallocate(data_, size_ * sizeof(T));
+            }
+            else
+            {
+                OPENSSL_free(data_);
+            }
+        }
+
         size_t size_;
         T *data_;
+        MemoryKind kind_;
     };
 
     // Utility function to create a secure buffer
@@ -141,17 +202,16 @@ namespace quantum
 
     // Buffer classes with secure memory handling
 
-    // Base Buffer class inheriting from SecureBuffer<uint8_t>
+    // Base Buffer class inheriting from SecureBuffer<uint8_t>. Plain Buffers
+    // live on the ordinary heap; PrivateKey and SharedSecret take the secure
+    // heap, and keep it when moved into a Buffer.
     class Buffer : public SecureBuffer<uint8_t>
     {
     public:
-        explicit Buffer(size_t size) : SecureBuffer<uint8_t>(size) {}
+        explicit Buffer(size_t size) : Buffer(size, MemoryKind::ORDINARY) {}
 
         // Constructor from raw data
-        Buffer(const uint8_t *data, size_t size) : SecureBuffer<uint8_t>(size)
-        {
-            std::memcpy(this->data(), data, size);
-        }
+        Buffer(const uint8_t *data, size_t size) : Buffer(data, size, MemoryKind::ORDINARY) {}
 
         // Convert buffer to Base64 string
         std::string toBase64() const
@@ -247,13 +307,22 @@ namespace quantum
         {
             clear();
         }
+
+    protected:
+        Buffer(size_t size, MemoryKind kind) : SecureBuffer<uint8_t>(size, kind) {}
+
+        Buffer(const uint8_t *data, size_t size, MemoryKind kind) : SecureBuffer<uint8_t>(size, kind)
+        {
+            std::memcpy(this->data(), data, size);
+        }
     };
 
-    // PrivateKey class inheriting from Buffer
+    // PrivateKey class inheriting from Buffer, held on the secure heap
     class PrivateKey : public Buffer
     {
     public:
-        using Buffer::Buffer;
+        explicit PrivateKey(size_t size) : Buffer(size, MemoryKind::SECURE) {}
+        PrivateKey(const uint8_t *data, size_t size) : Buffer(data, size, MemoryKind::SECURE) {}
 
         void zeroize()
         {
@@ -297,11 +366,12 @@ namespace quantum
         }
     };
 
-    // SharedSecret class inheriting from Buffer
+    // SharedSecret class inheriting from Buffer, held on the secure heap
     class SharedSecret : public Buffer
     {
     public:
-        using Buffer::Buffer;
+        explicit SharedSecret(size_t size) : Buffer(size, MemoryKind::SECURE) {}
+        SharedSecret(const uint8_t *data, size_t size) : Buffer(data, size, MemoryKind::SECURE) {}
 
         void zeroize()
         {
@@ -0,0 +1,270 @@
+#include "merkle.h"
+#include "hash_engine.h"
+#include "thread_pool.h"
+#include <algorithm>
+#include <cstring>
+#include <functional>
+#include <stdexcept>
+
+namespace quantum
+{
+
+    namespace
+    {
+        constexpr uint8_t LEAF_PREFIX = 0x00;
+        constexpr uint8_t NODE_PREFIX = 0x01;
+        constexpr size_t PAIR_SIZE = 1 + 2 * MerkleTree::NODE_SIZE;
+        // Parents hashed per task; also the layer size below which the
+        // layer is hashed on the calling thread.
+        constexpr size_t CHUNK = 1024;
+
+        void hashPair(const uint8_t *left, const uint8_t *right, uint8_t *out)
+        {
+            uint8_t input[PAIR_SIZE];
+            input[0] = NODE_PREFIX;
+            std::memcpy(input + 1, left, MerkleTree::NODE_SIZE);
+            std::memcpy(input + 1 + MerkleTree::NODE_SIZE, right, MerkleTree::NODE_SIZE);
+            HashEngine::hash(HashAlgorithm::SHA3_256, input, sizeof(input), out, MerkleTree::NODE_SIZE);
+        }
+
+        // Hash parents [first, last) of a layer in one multi-buffer batch.
+        void hashParents(const uint8_t *children, size_t childCount, uint8_t *parents, size_t first, size_t last)
+        {
+            size_t count = last - first;
+            std::vector<uint8_t> inputs(count * PAIR_SIZE);
+            std::vector<const uint8_t *> data(count);
+            std::vector<size_t> lengths(count, PAIR_SIZE);
+
+            for (size_t i = 0; i < count; ++i)
+            {
+                size_t left = 2 * (first + i);
+                size_t right = left + 1 < childCount ? left + 1 : left;
+                uint8_t *input = inputs.data() + i * PAIR_SIZE;
+                input[0] = NODE_PREFIX;
+                std::memcpy(input + 1, children + left * MerkleTree::NODE_SIZE, MerkleTree::NODE_SIZE);
+                std::memcpy(input + 1 + MerkleTree::NODE_SIZE, children + right * MerkleTree::NODE_SIZE, MerkleTree::NODE_SIZE);
+                data[i] = input;
+            }
+
+            HashEngine::hashBatch(HashAlgorithm::SHA3_256, data.data(), lengths.data(), count,
+                                  parents + first * MerkleTree::NODE_SIZE, MerkleTree::NODE_SIZE);
+        }
+
+        // Split [0, count) into CHUNK-sized pieces and run them on the pool.
+        void forEachChunk(size_t count, ThreadPool *pool, const std::function<void(size_t, size_t)> &fn)
+        {
+            size_t chunks = (count + CHUNK - 1) / CHUNK;
+            auto run = [&](size_t chunk)
+            {
+                size_t first = chunk * CHUNK;
+                fn(first, std::min(count, first + CHUNK));
+            };
+
+            if (pool && chunks > 1)
+            {
+                pool->parallelFor(chunks, run);
+            }
+            else
+            {
+                for (size_t chunk = 0; chunk < chunks; ++chunk)
+                {
+                    run(chunk);
+                }
+            }
+        }
+    }
+
+    size_t MerkleTree::nodeCount(size_t leafCount)
+    {
+        if (leafCount == 0)
+        {
+            return 0;
+        }
+        size_t total = leafCount;
+        for (size_t size = leafCount; size > 1;)
+        {
+            size = (size + 1) / 2;
+            total += size;
+        }
+        return total;
+    }
+
+    void MerkleTree::computeLayout()
+    {
+        layerOffsets_.clear();
+        layerSizes_.clear();
+        size_t offset = 0;
+        size_t size = leafCount_;
+        for (;;)
+        {
+            layerOffsets_.push_back(offset);
+            layerSizes_.push_back(size);
+            offset += size;
+            if (size == 1)
+            {
+                break;
+            }
+            size = (size + 1) / 2;
+        }
+    }
+
+    MerkleTree::MerkleTree(std::vector<uint8_t> nodes, size_t leafCount)
+        : nodes_(std::move(nodes)), leafCount_(leafCount)
+    {
+        if (leafCount_ == 0 || nodes_.size() != nodeCount(leafCount_) * NODE_SIZE)
+        {
+            throw std::invalid_argument("Merkle node layout does not match leaf count");
+        }
+        computeLayout();
+    }
+
+    MerkleTree MerkleTree::build(const uint8_t *leafHashes, size_t count, ThreadPool *pool)
+    {
+        if (count == 0)
+        {
+            throw std::invalid_argument("Merkle tree needs at least one leaf");
+        }
+
+        MerkleTree tree;
+        tree.leafCount_ = count;
+        tree.computeLayout();
+        tree.nodes_.resize(nodeCount(count) * NODE_SIZE);
+        std::memcpy(tree.nodes_.data(), leafHashes, count * NODE_SIZE);
+
+        for (size_t layer = 1; layer < tree.layerSizes_.size(); ++layer)
+        {
+            const uint8_t *children = tree.nodes_.data() + tree.layerOffsets_[layer - 1] * NODE_SIZE;
+            size_t childCount = tree.layerSizes_[layer - 1];
+            uint8_t *parents = tree.nodes_.data() + tree.layerOffsets_[layer] * NODE_SIZE;
+
+            forEachChunk(tree.layerSizes_[layer], pool, [&](size_t first, size_t last)
+                         { hashParents(children, childCount, parents, first, last); });
+        }
+        return tree;
+    }
+
+    void MerkleTree::hashLeaves(const uint8_t *const *data, const size_t *lengths, size_t count,
+                                uint8_t *out, ThreadPool *pool)
+    {
+        forEachChunk(count, pool, [&](size_t first, size_t last)
+                     {
+            // Prefix each leaf with the domain byte in a per-chunk arena
+            size_t total = 0;
+            for (size_t i = first; i < last; ++i)
+            {
+                total += 1 + lengths[i];
+            }
+            std::vector<uint8_t> arena(total);
+            std::vector<const uint8_t *> inputs(last - first);
+            std::vector<size_t> inputLengths(last - first);
+
+            size_t offset = 0;
+            for (size_t i = first; i < last; ++i)
+            {
+                arena[offset] = LEAF_PREFIX;
+                if (lengths[i] > 0)
+                {
+                    std::memcpy(arena.data() + offset + 1, data[i], lengths[i]);
+                }
+                inputs[i - first] = arena.data() + offset;
+                inputLengths[i - first] = 1 + lengths[i];
+                offset += 1 + lengths[i];
+            }
+
+            HashEngine::hashBatch(HashAlgorithm::SHA3_256, inputs.data(), inputLengths.data(), last - first,
+                                  out + first * NODE_SIZE, NODE_SIZE); });
+    }
+
+    const uint8_t *MerkleTree::root() const
+    {
+        return nodes_.data() + layerOffsets_.back() * NODE_SIZE;
+    }
+
+    MerkleProof MerkleTree::proof(size_t index) const
+    {
+        return proof(nodes_.data(), leafCount_, index);
+    }
+
+    MerkleProof MerkleTree::proof(const uint8_t *nodes, size_t leafCount, size_t index)
+    {
+        if (index >= leafCount)
+        {
+            throw std::out_of_range("Merkle leaf index out of range");
+        }
+
+        MerkleProof proof;
+        proof.index = index;
+        std::memcpy(proof.leaf, nodes + index * NODE_SIZE, NODE_SIZE);
+
+        // Walk the layers without building the layout tables
+        size_t offset = 0;
+        size_t size = leafCount;
+        size_t current = index;
+        while (size > 1)
+        {
+            size_t sibling = current ^ 1;
+            if (sibling >= size)
+            {
+                // Odd count: the node was paired with itself
+                sibling = current;
+            }
+            const uint8_t *node = nodes + (offset + sibling) * NODE_SIZE;
+            proof.siblings.insert(proof.siblings.end(), node, node + NODE_SIZE);
+            offset += size;
+            size = (size + 1) / 2;
+            current /= 2;
+        }
+        return proof;
+    }
+
+    bool MerkleTree::verify(const MerkleProof &proof, const uint8_t *root)
+    {
+        if (proof.siblings.size() % NODE_SIZE != 0)
+        {
+            return false;
+        }
+        size_t levels = proof.siblings.size() / NODE_SIZE;
+        if (levels < 64 && (proof.index >> levels) != 0)
+        {
+            return false;
+        }
+
+        uint8_t hash[NODE_SIZE];
+        std::memcpy(hash, proof.leaf, NODE_SIZE);
+        for (size_t level = 0; level < levels; ++level)
+        {
+            const uint8_t *sibling = proof.siblings.data() + level * NODE_SIZE;
+            if ((proof.index >> level) & 1)
+            {
+                hashPair(sibling, hash, hash);
+            }
+            else
+            {
+                hashPair(hash, sibling, hash);
+            }
+        }
+        return std::memcmp(hash, root, NODE_SIZE) == 0;
+    }
+
+    std::vector<uint8_t> MerkleTree::verifyBatch(const MerkleProof *proofs, size_t count,
+                                                 const uint8_t *root, ThreadPool *pool)
+    {
+        std::vector<uint8_t> results(count, 0);
+        auto check = [&](size_t i)
+        { results[i] = verify(proofs[i], root) ? 1 : 0; };
+
+        if (pool)
+        {
+            pool->parallelFor(count, check);
+        }
+        else
+        {
+            for (size_t i = 0; i < count; ++i)
+            {
+                check(i);
+            }
+        }
+        return results;
+    }
+
+} // namespace quantum
@@ -0,0 +1,77 @@
+#ifndef MERKLE_H
+#define MERKLE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace quantum
+{
+
+    class ThreadPool;
+
+    struct MerkleProof
+    {
+        size_t index{0};
+        uint8_t leaf[32]{};
+        std::vector<uint8_t> siblings; // 32 bytes per level, leaf level first
+    };
+
+    // Binary Merkle tree over 32-byte SHA3-256 nodes.
+    //
+    //   leaf   = SHA3-256(0x00 || data)
+    //   parent = SHA3-256(0x01 || left || right)
+    //
+    // An odd node at the end of a layer is paired with itself. Every layer
+    // is stored in one contiguous byte array, leaves first and the root last,
+    // so parents of a layer are hashed in parallel SIMD batches and proofs
+    // are read straight out of the flat layout.
+    class MerkleTree
+    {
+    public:
+        static constexpr size_t NODE_SIZE = 32;
+
+        // Build from leaf hashes (count * NODE_SIZE bytes). Layers larger
+        // than a few thousand nodes are split across the pool when given.
+        static MerkleTree build(const uint8_t *leafHashes, size_t count, ThreadPool *pool = nullptr);
+
+        // Leaf-hash count raw items into out (count * NODE_SIZE bytes).
+        static void hashLeaves(const uint8_t *const *data, const size_t *lengths, size_t count,
+                               uint8_t *out, ThreadPool *pool = nullptr);
+
+        // Adopt a flat layout previously produced by nodes().
+        MerkleTree(std::vector<uint8_t> nodes, size_t leafCount);
+
+        // Total nodes across all layers for a tree with leafCount leaves.
+        static size_t nodeCount(size_t leafCount);
+
+        const uint8_t *root() const;
+        const std::vector<uint8_t> &nodes() const { return nodes_; }
+        size_t leafCount() const { return leafCount_; }
+        size_t depth() const { return layerOffsets_.size(); }
+
+        MerkleProof proof(size_t index) const;
+
+        // Proof read straight from a borrowed flat layout, without copying
+        // it into a tree. nodes must hold nodeCount(leafCount) nodes.
+        static MerkleProof proof(const uint8_t *nodes, size_t leafCount, size_t index);
+
+        static bool verify(const MerkleProof &proof, const uint8_t *root);
+
+        // One byte per proof: 1 when it leads to root.
+        static std::vector<uint8_t> verifyBatch(const MerkleProof *proofs, size_t count,
+                                                const uint8_t *root, ThreadPool *pool = nullptr);
+
+    private:
+        MerkleTree() = default;
+        void computeLayout();
+
+        std::vector<uint8_t> nodes_;
+        std::vector<size_t> layerOffsets_; // in nodes
+        std::vector<size_t> layerSizes_;
+        size_t leafCount_{0};
+    };
+
+} // namespace quantum
+
+#endif // MERKLE_H
@@ -0,0 +1,242 @@
+#include "miner.h"
+#include "keccak.h"
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+namespace quantum
+{
+
+    namespace
+    {
+        constexpr size_t SHA3_256_RATE = 136;
+        constexpr size_t MAX_NONCE_DIGITS = 20;
+        // Nonces claimed per step; large enough to amortize the atomic,
+        // small enough that threads stop promptly once a winner is found.
+        constexpr uint64_t CHUNK = 4096;
+
+        size_t formatDecimal(uint64_t value, uint8_t out[MAX_NONCE_DIGITS])
+        {
+            uint8_t reversed[MAX_NONCE_DIGITS];
+            size_t length = 0;
+            do
+            {
+                reversed[length++] = static_cast<uint8_t>('0' + value % 10);
+                value /= 10;
+            } while (value != 0);
+            for (size_t i = 0; i < length; ++i)
+            {
+                out[i] = reversed[length - 1 - i];
+            }
+            return length;
+        }
+
+        bool meetsTarget(const uint8_t hash[32], const uint8_t target[32])
+        {
+            return std::memcmp(hash, target, 32) <= 0;
+        }
+
+        void pinToCore(unsigned index)
+        {
+#ifdef __linux__
+            unsigned cores = std::max(1u, std::thread::hardware_concurrency());
+            cpu_set_t set;
+            CPU_ZERO(&set);
+            CPU_SET(index % cores, &set);
+            pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+#else
+            (void)index;
+#endif
+        }
+
+        struct Search
+        {
+            const MiningJob &job;
+            const std::atomic<bool> *cancel;
+            // Keccak state after absorbing every whole block of the prefix;
+            // `offset` bytes of the partial block are already XORed in.
+            uint64_t midstate[keccak::STATE_WORDS];
+            size_t offset;
+            bool vectorTail;
+
+            std::atomic<uint64_t> next;
+            std::atomic<uint64_t> hashes{0};
+            std::atomic<bool> found{false};
+            std::mutex resultMutex;
+            MiningResult result;
+
+            Search(const MiningJob &j, const std::atomic<bool> *c)
+                : job(j), cancel(c), next(j.startNonce)
+            {
+                keccak::Sponge sponge(SHA3_256_RATE, keccak::SHA3_SUFFIX);
+                if (!job.headerPrefix.empty())
+                {
+                    sponge.absorb(job.headerPrefix.data(), job.headerPrefix.size());
+                }
+                std::memcpy(midstate, sponge.state(), sizeof(midstate));
+                offset = sponge.offset();
+                // Four-lane path needs every nonce and its padding to fit in
+                // the prefix's final block.
+                vectorTail = offset + MAX_NONCE_DIGITS + 1 <= SHA3_256_RATE;
+            }
+
+            bool stopped() const
+            {
+                return found.load(std::memory_order_relaxed) ||
+                       (cancel && cancel->load(std::memory_order_relaxed));
+            }
+
+            void report(uint64_t nonce, const uint8_t hash[32])
+            {
+                std::lock_guard<std::mutex> lock(resultMutex);
+                if (!result.found)
+                {
+                    result.found = true;
+                    result.nonce = nonce;
+                    std::memcpy(result.hash, hash, 32);
+                    found.store(true, std::memory_order_relaxed);
+                }
+            }
+
+            static void xorByte(uint64_t *state, size_t position, uint8_t value)
+            {
+                state[position / 8] ^= static_cast<uint64_t>(value) << (8 * (position % 8));
+            }
+
+            void hashScalar(uint64_t nonce, uint8_t out[32]) const
+            {
+                keccak::Sponge sponge(SHA3_256_RATE, keccak::SHA3_SUFFIX);
+                if (!job.headerPrefix.empty())
+                {
+                    sponge.absorb(job.headerPrefix.data(), job.headerPrefix.size());
+                }
+                uint8_t digits[MAX_NONCE_DIGITS];
+                sponge.absorb(digits, formatDecimal(nonce, digits));
+                sponge.squeeze(out, 32);
+            }
+
+            void hashX4(uint64_t first, size_t lanes, uint8_t out[keccak::LANES][32]) const
+            {
+                keccak::StateX4 state;
+                for (size_t l = 0; l < keccak::LANES; ++l)
+                {
+                    uint64_t lane[keccak::STATE_WORDS];
+                    std::memcpy(lane, midstate, sizeof(lane));
+                    if (l < lanes)
+                    {
+                        uint8_t digits[MAX_NONCE_DIGITS];
+                        size_t length = formatDecimal(first + l, digits);
+                        for (size_t i = 0; i < length; ++i)
+                        {
+                            xorByte(lane, offset + i, digits[i]);
+                        }
+                        xorByte(lane, offset + length, keccak::SHA3_SUFFIX);
+                        xorByte(lane, SHA3_256_RATE - 1, 0x80);
+                    }
+                    for (size_t i = 0; i < keccak::STATE_WORDS; ++i)
+                    {
+                        state.words[i][l] = lane[i];
+                    }
+                }
+
+                keccak::permuteX4(state);
+
+                for (size_t l = 0; l < lanes; ++l)
+                {
+                    for (size_t w = 0; w < 4; ++w)
+                    {
+                        keccak::store64(out[l] + 8 * w, state.words[w][l]);
+                    }
+                }
+            }
+
+            void work()
+            {
+                uint8_t hashes4[keccak::LANES][32];
+                while (!stopped())
+                {
+                    uint64_t begin = next.fetch_add(CHUNK, std::memory_order_relaxed);
+                    if (begin >= job.endNonce)
+                    {
+                        return;
+                    }
+                    uint64_t end = std::min(job.endNonce, begin + CHUNK);
+
+                    for (uint64_t nonce = begin; nonce < end && !found.load(std::memory_order_relaxed);)
+                    {
+                        if (vectorTail)
+                        {
+                            size_t lanes = static_cast<size_t>(std::min<uint64_t>(keccak::LANES, end - nonce));
+                            hashX4(nonce, lanes, hashes4);
+                            for (size_t l = 0; l < lanes; ++l)
+                            {
+                                if (meetsTarget(hashes4[l], job.target))
+                                {
+                                    report(nonce + l, hashes4[l]);
+                                    break;
+                                }
+                            }
+                            nonce += lanes;
+                        }
+                        else
+                        {
+                            hashScalar(nonce, hashes4[0]);
+                            if (meetsTarget(hashes4[0], job.target))
+                            {
+                                report(nonce, hashes4[0]);
+                            }
+                            ++nonce;
+                        }
+                    }
+                    hashes.fetch_add(end - begin, std::memory_order_relaxed);
+                }
+            }
+        };
+    }
+
+    MiningResult Miner::mine(const MiningJob &job, const std::atomic<bool> *cancel)
+    {
+        if (job.endNonce <= job.startNonce)
+        {
+            throw std::invalid_argument("Invalid nonce range");
+        }
+
+        auto started = std::chrono::steady_clock::now();
+        Search search(job, cancel);
+
+        unsigned threads = job.threads != 0 ? job.threads : std::max(1u, std::thread::hardware_concurrency());
+        uint64_t chunks = (job.endNonce - job.startNonce + CHUNK - 1) / CHUNK;
+        threads = static_cast<unsigned>(std::min<uint64_t>(threads, chunks));
+
+        std::vector<std::thread> workers;
+        workers.reserve(threads);
+        for (unsigned t = 0; t < threads; ++t)
+        {
+            workers.emplace_back([&search, &job, t]()
+                                 {
+                if (job.pinThreads)
+                {
+                    pinToCore(job.coreOffset + t);
+                }
+                search.work(); });
+        }
+        for (auto &worker : workers)
+        {
+            worker.join();
+        }
+
+        MiningResult result = search.result;
+        result.hashes = search.hashes.load();
+        result.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - started).count();
+        return result;
+    }
+
+} // namespace quantum
@@ -0,0 +1,54 @@
+#ifndef MINER_H
+#define MINER_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace quantum
+{
+
+    // Proof-of-work search over SHA3-256(headerPrefix || decimal(nonce)),
+    // the same preimage MiningWorker builds as `${headerBase}${nonce}`.
+    struct MiningJob
+    {
+        std::vector<uint8_t> headerPrefix;
+        uint64_t startNonce{0};
+        uint64_t endNonce{0};       // exclusive
+        uint8_t target[32]{};       // big-endian; a hash wins when hash <= target
+        unsigned threads{0};        // 0 = one per hardware core
+        // Pin worker t to core (coreOffset + t) where supported. Off by
+        // default: concurrent jobs would otherwise all pile onto core 0.
+        bool pinThreads{false};
+        unsigned coreOffset{0};
+    };
+
+    struct MiningResult
+    {
+        bool found{false};
+        uint64_t nonce{0};
+        uint8_t hash[32]{};
+        uint64_t hashes{0};
+        double seconds{0.0};
+
+        double hashRate() const
+        {
+            return seconds > 0.0 ? static_cast<double>(hashes) / seconds : 0.0;
+        }
+    };
+
+    class Miner
+    {
+    public:
+        // Searches [startNonce, endNonce) and returns as soon as any thread
+        // finds a winning nonce, the range is exhausted, or *cancel is set.
+        //
+        // The header prefix is absorbed into a Keccak state once; each nonce
+        // then costs a single permutation, four nonces per AVX2 pass.
+        static MiningResult mine(const MiningJob &job, const std::atomic<bool> *cancel = nullptr);
+    };
+
+} // namespace quantum
+
+#endif // MINER_H
@@ -0,0 +1,61 @@
+#include "prehash.h"
+#include "quantum.h"
+#include <cstring>
+
+namespace quantum
+{
+
+    namespace
+    {
+        // SHAKE-256
+        constexpr size_t RATE = 136;
+    }
+
+    const uint8_t Prehash::TAG[Prehash::TAG_SIZE] = {
+        'H', '3', 'T', 'A', 'G', '-', 'P', 'R', 'E', 'H', 'A', 'S', 'H', '-', 'V', '1'};
+
+    Prehash::Prehash(const OQS_SIG &sig, uint8_t cacheScheme, ByteSpan context)
+        : sponge_(RATE, keccak::SHAKE_SUFFIX), sig_(&sig), cacheScheme_(cacheScheme)
+    {
+        if (context.size() > MAX_CONTEXT)
+        {
+            throw QuantumError("Pre-hash context exceeds 255 bytes");
+        }
+        // Length-prefixed header, so no scheme/context pair can run into
+        // the message of another
+        size_t nameLength = std::strlen(sig.method_name);
+        uint8_t lengths[2] = {static_cast<uint8_t>(nameLength), static_cast<uint8_t>(context.size())};
+        sponge_.absorb(TAG, TAG_SIZE);
+        sponge_.absorb(&lengths[0], 1);
+        sponge_.absorb(reinterpret_cast<const uint8_t *>(sig.method_name), nameLength);
+        sponge_.absorb(&lengths[1], 1);
+        sponge_.absorb(context.data(), context.size());
+    }
+
+    void Prehash::update(ByteSpan data)
+    {
+        if (finished_)
+        {
+            throw QuantumError("Pre-hash already finished");
+        }
+        sponge_.absorb(data.data(), data.size());
+    }
+
+    void Prehash::finish(uint8_t out[MESSAGE_SIZE])
+    {
+        if (finished_)
+        {
+            throw QuantumError("Pre-hash already finished");
+        }
+        finished_ = true;
+        sponge_.finalize();
+        std::memcpy(out, TAG, TAG_SIZE);
+        sponge_.squeeze(out + TAG_SIZE, DIGEST_SIZE);
+    }
+
+    bool Prehash::isPrehashMessage(ByteSpan message)
+    {
+        return message.size() == MESSAGE_SIZE && std::memcmp(message.data(), TAG, TAG_SIZE) == 0;
+    }
+
+} // namespace quantum
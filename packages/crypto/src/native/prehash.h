@@ -0,0 +1,55 @@
+#ifndef PREHASH_H
+#define PREHASH_H
+
+#include "memory.h"
+#include "keccak.h"
+#include <cstddef>
+#include <cstdint>
+
+struct OQS_SIG; // oqs/oqs.h
+
+namespace quantum
+{
+
+    // Incremental message digest for signing or verifying payloads that
+    // are never held in memory at once. The message is absorbed into
+    // SHAKE-256 after a header naming the signature scheme and an optional
+    // context string; what gets signed is TAG || 64-byte digest. Plain
+    // sign() refuses messages of that form, so a pre-hashed signature can
+    // never be passed off as one over a raw message or vice versa.
+    //
+    // Created by QuantumCrypto::beginPrehash / beginFalconPrehash and
+    // consumed by signPrehashed / verifyPrehashed.
+    class Prehash
+    {
+    public:
+        static constexpr size_t TAG_SIZE = 16;
+        static constexpr size_t DIGEST_SIZE = 64;
+        static constexpr size_t MESSAGE_SIZE = TAG_SIZE + DIGEST_SIZE;
+        static constexpr size_t MAX_CONTEXT = 255;
+        static const uint8_t TAG[TAG_SIZE];
+
+        void update(ByteSpan data);
+        void update(const uint8_t *data, size_t length) { update(ByteSpan(data, length)); }
+        bool finished() const { return finished_; }
+
+        // True when a raw message lies in the pre-hash domain
+        static bool isPrehashMessage(ByteSpan message);
+
+    private:
+        friend class QuantumCrypto;
+
+        Prehash(const OQS_SIG &sig, uint8_t cacheScheme, ByteSpan context);
+
+        // Pad the sponge and write TAG || digest. Only once per Prehash.
+        void finish(uint8_t out[MESSAGE_SIZE]);
+
+        keccak::Sponge sponge_;
+        const OQS_SIG *sig_;
+        uint8_t cacheScheme_;
+        bool finished_{false};
+    };
+
+} // namespace quantum
+
+#endif // PREHASH_H
@@ -0,0 +1,96 @@
+#include "prepared_keys.h"
+#include <openssl/sha.h>
+#include <cstring>
+
+namespace quantum
+{
+
+    PreparedKeyCache::PreparedKeyCache(size_t capacity)
+        : capacity_(capacity) {}
+
+    size_t PreparedKeyCache::SlotHash::operator()(const Slot &slot) const
+    {
+        // Fingerprints are SHA-256 output, so any 8 bytes are uniform
+        uint64_t value;
+        std::memcpy(&value, slot.fingerprint.data(), sizeof(value));
+        return static_cast<size_t>(value ^ slot.cacheScheme);
+    }
+
+    bool PreparedKeyCache::SlotEqual::operator()(const Slot &a, const Slot &b) const
+    {
+        return a.cacheScheme == b.cacheScheme && a.fingerprint == b.fingerprint;
+    }
+
+    PreparedKeyCache::Fingerprint PreparedKeyCache::fingerprint(ByteSpan publicKey)
+    {
+        Fingerprint digest;
+        SHA256(publicKey.data(), publicKey.size(), digest.data());
+        return digest;
+    }
+
+    PreparedKey PreparedKeyCache::get(uint8_t cacheScheme, ByteSpan publicKey, const Make &make)
+    {
+        Slot slot{fingerprint(publicKey), cacheScheme};
+        if (capacity_ == 0)
+        {
+            misses_.fetch_add(1, std::memory_order_relaxed);
+            return make(slot.fingerprint);
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            auto it = index_.find(slot);
+            // Compare the bytes too; the fingerprint alone is only a lookup key
+            if (it != index_.end() && it->second->second->key.size() == publicKey.size() &&
+                std::memcmp(it->second->second->key.data(), publicKey.data(), publicKey.size()) == 0)
+            {
+                lru_.splice(lru_.begin(), lru_, it->second);
+                hits_.fetch_add(1, std::memory_order_relaxed);
+                return it->second->second;
+            }
+        }
+        misses_.fetch_add(1, std::memory_order_relaxed);
+
+        // Built outside the lock; a concurrent miss on the same key just
+        // builds it twice and the later one wins the slot
+        PreparedKey prepared = make(slot.fingerprint);
+
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = index_.find(slot);
+        if (it != index_.end())
+        {
+            it->second->second = prepared;
+            lru_.splice(lru_.begin(), lru_, it->second);
+            return prepared;
+        }
+        lru_.emplace_front(slot, prepared);
+        index_.emplace(slot, lru_.begin());
+        if (lru_.size() > capacity_)
+        {
+            index_.erase(lru_.back().first);
+            lru_.pop_back();
+            evictions_.fetch_add(1, std::memory_order_relaxed);
+        }
+        return prepared;
+    }
+
+    void PreparedKeyCache::clear()
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        index_.clear();
+        lru_.clear();
+    }
+
+    PreparedKeyStats PreparedKeyCache::stats() const
+    {
+        PreparedKeyStats stats;
+        stats.hits = hits_.load(std::memory_order_relaxed);
+        stats.misses = misses_.load(std::memory_order_relaxed);
+        stats.evictions = evictions_.load(std::memory_order_relaxed);
+        stats.capacity = capacity_;
+        std::lock_guard<std::mutex> lock(mutex_);
+        stats.entries = lru_.size();
+        return stats;
+    }
+
+} // namespace quantum
@@ -0,0 +1,97 @@
+#ifndef PREPARED_KEYS_H
+#define PREPARED_KEYS_H
+
+#include "memory.h"
+#include "verify_cache.h"
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+struct OQS_SIG; // oqs/oqs.h
+
+namespace quantum
+{
+
+    struct PreparedKeyStats
+    {
+        uint64_t hits{0};
+        uint64_t misses{0};
+        uint64_t evictions{0};
+        size_t entries{0};
+        size_t capacity{0};
+    };
+
+    // A signer's public key, checked against its scheme and digested once
+    // so that verifications against it skip that work. Immutable and
+    // shared; a holder keeps it alive after eviction from the cache.
+    struct PreparedPublicKey
+    {
+        const OQS_SIG *sig;
+        uint8_t cacheScheme;
+        PublicKey key;
+        // SHA-256 of the key, the raw form of PublicKey::getFingerprint()
+        std::array<uint8_t, 32> fingerprint;
+        // Stands in for the key in verify cache entries
+        VerifyCache::Key cacheDigest;
+    };
+
+    using PreparedKey = std::shared_ptr<const PreparedPublicKey>;
+
+    // Bounded LRU of prepared keys, keyed by scheme and fingerprint, so
+    // validators that see the same producers, auditors or voters over and
+    // over prepare each of them once.
+    class PreparedKeyCache
+    {
+    public:
+        using Fingerprint = std::array<uint8_t, 32>;
+        using Make = std::function<PreparedKey(const Fingerprint &)>;
+
+        // capacity 0 disables caching; get() then always calls make.
+        explicit PreparedKeyCache(size_t capacity);
+
+        PreparedKeyCache(const PreparedKeyCache &) = delete;
+        PreparedKeyCache &operator=(const PreparedKeyCache &) = delete;
+
+        // The cached key for these bytes, or the one built by make.
+        PreparedKey get(uint8_t cacheScheme, ByteSpan publicKey, const Make &make);
+        void clear();
+        PreparedKeyStats stats() const;
+
+        static Fingerprint fingerprint(ByteSpan publicKey);
+
+    private:
+        struct Slot
+        {
+            Fingerprint fingerprint;
+            uint8_t cacheScheme;
+        };
+
+        struct SlotHash
+        {
+            size_t operator()(const Slot &slot) const;
+        };
+
+        struct SlotEqual
+        {
+            bool operator()(const Slot &a, const Slot &b) const;
+        };
+
+        size_t capacity_;
+        mutable std::mutex mutex_;
+        std::list<std::pair<Slot, PreparedKey>> lru_; // most recently used first
+        std::unordered_map<Slot, std::list<std::pair<Slot, PreparedKey>>::iterator, SlotHash, SlotEqual> index_;
+
+        std::atomic<uint64_t> hits_{0};
+        std::atomic<uint64_t> misses_{0};
+        std::atomic<uint64_t> evictions_{0};
+    };
+
+} // namespace quantum
+
+#endif // PREPARED_KEYS_H
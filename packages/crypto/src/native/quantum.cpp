@@ -6,6 +6,15 @@
 #include <stdexcept>
 #include <mutex>
 #include "entropy_pool.h"
+#include "thread_pool.h"
+#include "keccak.h"
+#include "secp256k1.h"
+#include <atomic>
+#include <cstdio>
+#include <functional>
+#include <limits>
+#include <shared_mutex>
+#include <unordered_map>
 #include <oqs/oqs.h>
 
 // Option (a): Define the default security parameters.
@@ -14,257 +23,1506 @@ const quantum::SecurityParams quantum::SecurityParams::DEFAULT = {256, 256, true
 namespace quantum
 {
 
+    namespace
+    {
+        struct SchemeNames
+        {
+            const char *signature;
+            const char *kem;
+        };
+
+        // Indexed by SecurityLevel
+        const SchemeNames SCHEME_NAMES[SECURITY_LEVEL_COUNT] = {
+            {OQS_SIG_alg_dilithium_5, OQS_KEM_alg_kyber_1024},
+            {OQS_SIG_alg_ml_dsa_44, OQS_KEM_alg_ml_kem_512},
+            {OQS_SIG_alg_ml_dsa_65, OQS_KEM_alg_ml_kem_768},
+            {OQS_SIG_alg_ml_dsa_87, OQS_KEM_alg_ml_kem_1024},
+        };
+
+        // Indexed by FalconVariant
+        const char *const FALCON_NAMES[FALCON_VARIANT_COUNT] = {
+            OQS_SIG_alg_falcon_512,
+            OQS_SIG_alg_falcon_1024,
+        };
+
+        // Verify cache scheme byte; SecurityLevel values occupy 0..3
+        uint8_t falconCacheScheme(FalconVariant variant)
+        {
+            return static_cast<uint8_t>(0x10 + static_cast<uint32_t>(variant));
+        }
+
+        // Known-answer vectors for the health check. They are generated once
+        // with fresh keys; later runs verify, decapsulate and compare
+        // against the stored answers, which are deterministic.
+        struct SignatureVector
+        {
+            const OQS_SIG *sig{nullptr};
+            std::vector<uint8_t> publicKey;
+            std::vector<uint8_t> signature;
+        };
+
+        struct KemVector
+        {
+            const OQS_KEM *kem{nullptr};
+            std::unique_ptr<PrivateKey> secretKey;
+            std::vector<uint8_t> ciphertext;
+            std::unique_ptr<SharedSecret> sharedSecret;
+        };
+
+        struct KnownAnswers
+        {
+            SignatureVector signatures[SECURITY_LEVEL_COUNT];
+            KemVector kems[SECURITY_LEVEL_COUNT];
+            SignatureVector falcon[FALCON_VARIANT_COUNT];
+        };
+
+        const uint8_t KAT_MESSAGE[] = "h3tag known-answer test";
+
+        // FIPS 202 SHA3-256("abc")
+        const uint8_t SHA3_ABC[32] = {
+            0x3a, 0x98, 0x5d, 0xa7, 0x4f, 0xe2, 0x25, 0xb2, 0x04, 0x5c, 0x17, 0x2d, 0x6b, 0xd3, 0x90, 0xbd,
+            0x85, 0x5f, 0x08, 0x6e, 0x3e, 0x9d, 0x52, 0x5b, 0x46, 0xbf, 0xe2, 0x45, 0x11, 0x43, 0x15, 0x32};
+
+        void makeSignatureVector(const OQS_SIG *sig, SignatureVector &vector)
+        {
+            if (!sig)
+            {
+                return;
+            }
+            PrivateKey secretKey(sig->length_secret_key);
+            std::vector<uint8_t> publicKey(sig->length_public_key);
+            std::vector<uint8_t> signature(sig->length_signature);
+            size_t signatureLength = 0;
+            if (OQS_SIG_keypair(sig, publicKey.data(), secretKey.data()) != OQS_SUCCESS ||
+                OQS_SIG_sign(sig, signature.data(), &signatureLength, KAT_MESSAGE, sizeof(KAT_MESSAGE),
+                             secretKey.data()) != OQS_SUCCESS)
+            {
+                return;
+            }
+            signature.resize(signatureLength);
+            vector.publicKey = std::move(publicKey);
+            vector.signature = std::move(signature);
+            vector.sig = sig;
+        }
+
+        void makeKemVector(const OQS_KEM *kem, KemVector &vector)
+        {
+            if (!kem)
+            {
+                return;
+            }
+            auto secretKey = std::make_unique<PrivateKey>(kem->length_secret_key);
+            auto sharedSecret = std::make_unique<SharedSecret>(kem->length_shared_secret);
+            std::vector<uint8_t> publicKey(kem->length_public_key);
+            std::vector<uint8_t> ciphertext(kem->length_ciphertext);
+            if (OQS_KEM_keypair(kem, publicKey.data(), secretKey->data()) != OQS_SUCCESS ||
+                OQS_KEM_encaps(kem, ciphertext.data(), sharedSecret->data(), publicKey.data()) != OQS_SUCCESS)
+            {
+                return;
+            }
+            vector.secretKey = std::move(secretKey);
+            vector.ciphertext = std::move(ciphertext);
+            vector.sharedSecret = std::move(sharedSecret);
+            vector.kem = kem;
+        }
+
+        // The stored signature must verify and a one-bit change must not
+        bool checkSignatureVector(const SignatureVector &vector)
+        {
+            if (!vector.sig)
+            {
+                return false;
+            }
+            if (OQS_SIG_verify(vector.sig, KAT_MESSAGE, sizeof(KAT_MESSAGE), vector.signature.data(),
+                               vector.signature.size(), vector.publicKey.data()) != OQS_SUCCESS)
+            {
+                return false;
+            }
+            std::vector<uint8_t> tampered = vector.signature;
+            tampered[tampered.size() / 2] ^= 0x01;
+            return OQS_SIG_verify(vector.sig, KAT_MESSAGE, sizeof(KAT_MESSAGE), tampered.data(),
+                                  tampered.size(), vector.publicKey.data()) != OQS_SUCCESS;
+        }
+
+        // Decapsulation must reproduce the stored secret, and a modified
+        // ciphertext must yield a different one (implicit rejection)
+        bool checkKemVector(const KemVector &vector)
+        {
+            if (!vector.kem)
+            {
+                return false;
+            }
+            SharedSecret sharedSecret(vector.kem->length_shared_secret);
+            if (OQS_KEM_decaps(vector.kem, sharedSecret.data(), vector.ciphertext.data(),
+                               vector.secretKey->data()) != OQS_SUCCESS ||
+                !sharedSecret.equals(*vector.sharedSecret))
+            {
+                return false;
+            }
+            std::vector<uint8_t> tampered = vector.ciphertext;
+            tampered[0] ^= 0x01;
+            if (OQS_KEM_decaps(vector.kem, sharedSecret.data(), tampered.data(),
+                               vector.secretKey->data()) != OQS_SUCCESS)
+            {
+                return true;
+            }
+            return !sharedSecret.equals(*vector.sharedSecret);
+        }
+
+        bool checkSha3()
+        {
+            keccak::Sponge sponge(136, keccak::SHA3_SUFFIX);
+            const uint8_t input[] = {'a', 'b', 'c'};
+            uint8_t digest[32];
+            sponge.absorb(input, sizeof(input));
+            sponge.finalize();
+            sponge.squeeze(digest, sizeof(digest));
+            return CRYPTO_memcmp(digest, SHA3_ABC, sizeof(digest)) == 0;
+        }
+
+        // ML-KEM and round-3 Kyber decapsulation keys are laid out as
+        // dk_pke (384 bytes per module rank) || ek || SHA3-256(ek) || z.
+        // FIPS 203 section 7.3 checks the embedded hash before a key is
+        // used. Keys of any other layout are not checked.
+        bool kemKeyHashMatches(const OQS_KEM &kem, ByteSpan key)
+        {
+            constexpr size_t HASH_SIZE = 32;
+            size_t publicKeyLength = kem.length_public_key;
+            if (publicKeyLength < HASH_SIZE || (publicKeyLength - HASH_SIZE) % 384 != 0 ||
+                key.size() != (publicKeyLength - HASH_SIZE) + publicKeyLength + 2 * HASH_SIZE)
+            {
+                return true;
+            }
+            const uint8_t *publicKey = key.data() + (publicKeyLength - HASH_SIZE);
+            keccak::Sponge sponge(136, keccak::SHA3_SUFFIX);
+            uint8_t digest[HASH_SIZE];
+            sponge.absorb(publicKey, publicKeyLength);
+            sponge.finalize();
+            sponge.squeeze(digest, sizeof(digest));
+            return CRYPTO_memcmp(digest, publicKey + publicKeyLength, HASH_SIZE) == 0;
+        }
+
+        size_t levelIndex(SecurityLevel level)
+        {
+            size_t index = static_cast<size_t>(level);
+            if (index >= SECURITY_LEVEL_COUNT)
+            {
+                throw QuantumError("Unknown security level");
+            }
+            return index;
+        }
+    }
+
+    // liboqs contexts of one parameter set
+    struct Scheme
+    {
+        std::unique_ptr<OQS_SIG, decltype(&OQS_SIG_free)> sig{nullptr, OQS_SIG_free};
+        std::unique_ptr<OQS_KEM, decltype(&OQS_KEM_free)> kem{nullptr, OQS_KEM_free};
+    };
+
     // Implementation struct for PIMPL idiom
     struct QuantumCrypto::Implementation
     {
-        std::mutex mutex;
-        std::unique_ptr<OQS_SIG, decltype(&OQS_SIG_free)> dilithium;
-        std::unique_ptr<OQS_KEM, decltype(&OQS_KEM_free)> kyber;
-        SecurityMonitor monitor;
-        EntropyPool entropy;
-        // Store security parameters
-        SecurityParams securityParams;
+        std::mutex mutex;
+        // One set of contexts per SecurityLevel; a slot stays empty when the
+        // linked liboqs was built without that algorithm
+        Scheme schemes[SECURITY_LEVEL_COUNT];
+        std::unique_ptr<OQS_SIG, decltype(&OQS_SIG_free)> falconSigs[FALCON_VARIANT_COUNT] = {
+            {nullptr, OQS_SIG_free}, {nullptr, OQS_SIG_free}};
+        std::atomic<SecurityLevel> defaultLevel;
+        SecurityMonitor monitor;
+        EntropyPool entropy;
+        // Worker pool for batch operations, started on first use
+        std::once_flag poolInit;
+        std::unique_ptr<ThreadPool> pool;
+        // Outcomes of previous verifications, so a signature seen by the
+        // mempool is not verified again by the block validator
+        VerifyCache verifyCache;
+        // Public keys of repeat signers, validated and digested once
+        PreparedKeyCache preparedKeys;
+        // Private keys loaded for signing or decapsulation by handle
+        KeyRegistry keys;
+        // Store security parameters
+        SecurityParams securityParams;
+        // Background key pair pools keyed by their OQS_SIG / OQS_KEM context.
+        // ~QuantumCrypto clears them first, stopping the refill threads while
+        // the contexts, entropy pool and monitor they use are intact.
+        mutable std::shared_mutex keyPoolsMutex;
+        std::unordered_map<const void *, std::shared_ptr<KeyPairPool>> keyPools;
+        // Known-answer vectors, built on the first health check run
+        std::once_flag knownAnswersInit;
+        KnownAnswers knownAnswers;
+        // Stopped explicitly in ~QuantumCrypto
+        std::unique_ptr<HealthMonitor> health;
+
+        Implementation(const SecurityParams &params)
+            : defaultLevel(params.defaultLevel),
+              verifyCache(params.verifyCacheEntries),
+              preparedKeys(params.preparedKeyEntries),
+              securityParams(params)
+        {
+            if (params.secureHeapBytes > 0)
+            {
+                SecureArena::initialize(params.secureHeapBytes);
+            }
+            for (size_t i = 0; i < SECURITY_LEVEL_COUNT; ++i)
+            {
+                schemes[i].sig.reset(OQS_SIG_new(SCHEME_NAMES[i].signature));
+                schemes[i].kem.reset(OQS_KEM_new(SCHEME_NAMES[i].kem));
+            }
+            for (size_t i = 0; i < FALCON_VARIANT_COUNT; ++i)
+            {
+                falconSigs[i].reset(OQS_SIG_new(FALCON_NAMES[i]));
+            }
+            const Scheme &initial = schemes[levelIndex(params.defaultLevel)];
+            if (!initial.sig || !initial.kem)
+            {
+                throw QuantumError("Failed to initialize quantum algorithms");
+            }
+        }
+
+        const OQS_SIG &sig(SecurityLevel level) const
+        {
+            const auto &context = schemes[levelIndex(level)].sig;
+            if (!context)
+            {
+                throw QuantumError(std::string(SCHEME_NAMES[levelIndex(level)].signature) + " is not available");
+            }
+            return *context;
+        }
+
+        const OQS_KEM &kem(SecurityLevel level) const
+        {
+            const auto &context = schemes[levelIndex(level)].kem;
+            if (!context)
+            {
+                throw QuantumError(std::string(SCHEME_NAMES[levelIndex(level)].kem) + " is not available");
+            }
+            return *context;
+        }
+
+        const OQS_SIG &falcon(FalconVariant variant) const
+        {
+            size_t index = static_cast<size_t>(variant);
+            if (index >= FALCON_VARIANT_COUNT)
+            {
+                throw QuantumError("Unknown Falcon variant");
+            }
+            if (!falconSigs[index])
+            {
+                throw QuantumError(std::string(FALCON_NAMES[index]) + " is not available");
+            }
+            return *falconSigs[index];
+        }
+
+        std::shared_ptr<KeyPairPool> keyPool(const void *context) const
+        {
+            std::shared_lock<std::shared_mutex> lock(keyPoolsMutex);
+            auto it = keyPools.find(context);
+            return it == keyPools.end() ? nullptr : it->second;
+        }
+
+        SecurityLevel level() const
+        {
+            return defaultLevel.load(std::memory_order_relaxed);
+        }
+
+        // Entry behind a handle, which must hold a key of the given algorithm
+        std::shared_ptr<const KeyRegistry::Entry> loadedKey(KeyRegistry::Handle handle, KeyAlgorithm algorithm,
+                                                            const char *operation)
+        {
+            auto entry = keys.get(handle);
+            if (!entry || entry->algorithm != algorithm)
+            {
+                monitor.logFailure(operation, "Unknown key handle");
+                throw QuantumError("Unknown key handle");
+            }
+            return entry;
+        }
+
+        ~Implementation() = default;
+
+        ThreadPool &workers()
+        {
+            std::call_once(poolInit, [this]()
+                           { pool = std::make_unique<ThreadPool>(securityParams.workerThreads); });
+            return *pool;
+        }
+
+        // OQS_SIG / OQS_KEM are read-only method tables once created and the
+        // underlying liboqs primitives keep no per-context state, so in
+        // concurrent mode callers share them without taking the mutex.
+        std::unique_lock<std::mutex> acquire()
+        {
+            if (securityParams.concurrentExecution)
+            {
+                return std::unique_lock<std::mutex>(mutex, std::defer_lock);
+            }
+            return std::unique_lock<std::mutex>(mutex);
+        }
+    };
+
+    // Destructor implementation for QuantumCrypto
+    QuantumCrypto::~QuantumCrypto()
+    {
+        // Stop the background threads while the rest of QuantumCrypto is intact
+        pImpl->health.reset();
+        std::unique_lock<std::shared_mutex> lock(pImpl->keyPoolsMutex);
+        pImpl->keyPools.clear();
+    }
+
+    // Singleton access
+    QuantumCrypto &QuantumCrypto::getInstance(const SecurityParams &params)
+    {
+        // Note: In this singleton design, the first call "wins". Subsequent calls with
+        // different parameters will be ignored.
+        static QuantumCrypto instance(params);
+        return instance;
+    }
+
+    // Private constructor
+    QuantumCrypto::QuantumCrypto(const SecurityParams &params)
+        : pImpl(std::make_unique<Implementation>(params))
+    {
+        initializeSecurityMonitor();
+        pImpl->health = std::make_unique<HealthMonitor>([this]()
+                                                        { return runKnownAnswerTests(); },
+                                                        params.healthCheckIntervalMs);
+    }
+
+    // Parameter sets
+    void QuantumCrypto::setSecurityLevel(SecurityLevel level)
+    {
+        // Throws if the level is unknown or not built into liboqs
+        pImpl->sig(level);
+        pImpl->kem(level);
+        pImpl->defaultLevel.store(level, std::memory_order_relaxed);
+    }
+
+    SecurityLevel QuantumCrypto::securityLevel() const
+    {
+        return pImpl->level();
+    }
+
+    ParameterSetInfo QuantumCrypto::parameterSet(SecurityLevel level) const
+    {
+        size_t index = levelIndex(level);
+        const Scheme &scheme = pImpl->schemes[index];
+
+        ParameterSetInfo info{};
+        info.level = level;
+        info.available = scheme.sig && scheme.kem;
+        info.signatureAlgorithm = SCHEME_NAMES[index].signature;
+        info.kemAlgorithm = SCHEME_NAMES[index].kem;
+        if (scheme.sig)
+        {
+            info.publicKeyLength = scheme.sig->length_public_key;
+            info.privateKeyLength = scheme.sig->length_secret_key;
+            info.signatureLength = scheme.sig->length_signature;
+        }
+        if (scheme.kem)
+        {
+            info.kemPublicKeyLength = scheme.kem->length_public_key;
+            info.kemPrivateKeyLength = scheme.kem->length_secret_key;
+            info.ciphertextLength = scheme.kem->length_ciphertext;
+            info.sharedSecretLength = scheme.kem->length_shared_secret;
+        }
+        return info;
+    }
+
+    // Generate Dilithium Key Pair
+    KeyPair QuantumCrypto::generateDilithiumKeyPair()
+    {
+        return generateDilithiumKeyPair(pImpl->level());
+    }
+
+    KeyPair QuantumCrypto::generateDilithiumKeyPair(SecurityLevel level)
+    {
+        const OQS_SIG &sig = pImpl->sig(level);
+        if (auto pool = pImpl->keyPool(&sig))
+        {
+            return pool->take();
+        }
+        return generateSignatureKeyPair(sig, "Dilithium Key Generation");
+    }
+
+    KeyPair QuantumCrypto::generateFalconKeyPair(FalconVariant variant)
+    {
+        const OQS_SIG &sig = pImpl->falcon(variant);
+        if (auto pool = pImpl->keyPool(&sig))
+        {
+            return pool->take();
+        }
+        return generateSignatureKeyPair(sig, "Falcon Key Generation");
+    }
+
+    KeyPair QuantumCrypto::generateSignatureKeyPair(const OQS_SIG &sig, const char *operation)
+    {
+        OperationTimer timer(MonitoredOperation::KEYGEN);
+        auto lock = pImpl->acquire();
+
+        try
+        {
+            validateSecurityLevel();
+            monitorEntropy();
+
+            // Generate straight into the returned buffers; no intermediate copy
+            Buffer publicKey(sig.length_public_key);
+            PrivateKey privateKey(sig.length_secret_key);
+
+            int status = OQS_SIG_keypair(
+                &sig,
+                publicKey.data(),
+                privateKey.data());
+
+            if (status != OQS_SUCCESS)
+            {
+                throw QuantumError(std::string(sig.method_name) + " key generation failed");
+            }
+
+            timer.succeed();
+            return KeyPair{std::move(publicKey), std::move(privateKey)};
+        }
+        catch (const std::exception &e)
+        {
+            pImpl->monitor.logFailure(operation, e.what());
+            throw;
+        }
+    }
+
+    // Generate Kyber Key Pair
+    KeyPair QuantumCrypto::generateKyberKeyPair()
+    {
+        return generateKyberKeyPair(pImpl->level());
+    }
+
+    KeyPair QuantumCrypto::generateKyberKeyPair(SecurityLevel level)
+    {
+        const OQS_KEM &kem = pImpl->kem(level);
+        if (auto pool = pImpl->keyPool(&kem))
+        {
+            return pool->take();
+        }
+        return generateKemKeyPair(kem);
+    }
+
+    KeyPair QuantumCrypto::generateKemKeyPair(const OQS_KEM &kem)
+    {
+        OperationTimer timer(MonitoredOperation::KEYGEN);
+        auto lock = pImpl->acquire();
+
+        try
+        {
+            validateSecurityLevel();
+            monitorEntropy();
+
+            // Generate straight into the returned buffers; no intermediate copy
+            Buffer publicKey(kem.length_public_key);
+            PrivateKey privateKey(kem.length_secret_key);
+
+            int status = OQS_KEM_keypair(
+                &kem,
+                publicKey.data(),
+                privateKey.data());
+
+            if (status != OQS_SUCCESS)
+            {
+                throw QuantumError("Kyber key generation failed");
+            }
+
+            timer.succeed();
+            return KeyPair{std::move(publicKey), std::move(privateKey)};
+        }
+        catch (const std::exception &e)
+        {
+            pImpl->monitor.logFailure("Kyber Key Generation", e.what());
+            throw;
+        }
+    }
+
+    // Batch key generation
+    KeyPairBatch QuantumCrypto::generateKeyPairsBatch(KeyAlgorithm algorithm, size_t count)
+    {
+        return generateKeyPairsBatch(algorithm, pImpl->level(), count);
+    }
+
+    KeyPairBatch QuantumCrypto::generateKeyPairsBatch(KeyAlgorithm algorithm, SecurityLevel level, size_t count)
+    {
+        auto lock = pImpl->acquire();
+
+        try
+        {
+            if (count == 0)
+            {
+                throw QuantumError("Batch size must be positive");
+            }
+
+            std::function<int(uint8_t *, uint8_t *)> keypair;
+            const char *name;
+            size_t publicKeyLength;
+            size_t privateKeyLength;
+            switch (algorithm)
+            {
+            case KeyAlgorithm::DILITHIUM:
+            {
+                const OQS_SIG *sig = &pImpl->sig(level);
+                keypair = [sig](uint8_t *pk, uint8_t *sk)
+                { return OQS_SIG_keypair(sig, pk, sk); };
+                name = sig->method_name;
+                publicKeyLength = sig->length_public_key;
+                privateKeyLength = sig->length_secret_key;
+                break;
+            }
+            case KeyAlgorithm::KYBER:
+            {
+                const OQS_KEM *kem = &pImpl->kem(level);
+                keypair = [kem](uint8_t *pk, uint8_t *sk)
+                { return OQS_KEM_keypair(kem, pk, sk); };
+                name = kem->method_name;
+                publicKeyLength = kem->length_public_key;
+                privateKeyLength = kem->length_secret_key;
+                break;
+            }
+            default:
+                throw QuantumError("Unknown key algorithm");
+            }
+
+            if (count > std::numeric_limits<size_t>::max() / privateKeyLength)
+            {
+                throw QuantumError("Batch size is too large");
+            }
+
+            validateSecurityLevel();
+            // Once per batch rather than once per key pair
+            monitorEntropy();
+
+            KeyPairBatch batch{count, publicKeyLength, privateKeyLength,
+                               Buffer(count * publicKeyLength), Buffer(count * privateKeyLength)};
+            uint8_t *publicKeys = batch.publicKeys.data();
+            uint8_t *privateKeys = batch.privateKeys.data();
+
+            std::atomic<bool> failed{false};
+            auto generateOne = [&](size_t index)
+            {
+                if (failed.load(std::memory_order_relaxed))
+                {
+                    return;
+                }
+                OperationTimer timer(MonitoredOperation::KEYGEN);
+                if (keypair(publicKeys + index * publicKeyLength,
+                            privateKeys + index * privateKeyLength) != OQS_SUCCESS)
+                {
+                    failed.store(true, std::memory_order_relaxed);
+                    return;
+                }
+                timer.succeed();
+            };
+
+            if (pImpl->securityParams.concurrentExecution)
+            {
+                pImpl->workers().parallelFor(count, generateOne);
+            }
+            else
+            {
+                for (size_t i = 0; i < count; ++i)
+                {
+                    generateOne(i);
+                }
+            }
+
+            if (failed.load())
+            {
+                throw QuantumError(std::string(name) + " batch key generation failed");
+            }
+            return batch;
+        }
+        catch (const std::exception &e)
+        {
+            pImpl->monitor.logFailure("Batch Key Generation", e.what());
+            throw;
+        }
+    }
+
+    // Key pair pools
+    void QuantumCrypto::setDilithiumKeyPoolDepth(SecurityLevel level, size_t depth)
+    {
+        const OQS_SIG &sig = pImpl->sig(level);
+        setKeyPoolDepth(&sig, sig.method_name, [this, &sig]()
+                        { return generateSignatureKeyPair(sig, "Dilithium Key Generation"); }, depth);
+    }
+
+    void QuantumCrypto::setKyberKeyPoolDepth(SecurityLevel level, size_t depth)
+    {
+        const OQS_KEM &kem = pImpl->kem(level);
+        setKeyPoolDepth(&kem, kem.method_name, [this, &kem]()
+                        { return generateKemKeyPair(kem); }, depth);
+    }
+
+    void QuantumCrypto::setFalconKeyPoolDepth(FalconVariant variant, size_t depth)
+    {
+        const OQS_SIG &sig = pImpl->falcon(variant);
+        setKeyPoolDepth(&sig, sig.method_name, [this, &sig]()
+                        { return generateSignatureKeyPair(sig, "Falcon Key Generation"); }, depth);
+    }
+
+    void QuantumCrypto::setKeyPoolDepth(const void *context, const char *algorithm, KeyPairPool::Generator generate,
+                                        size_t depth)
+    {
+        std::shared_ptr<KeyPairPool> removed;
+        {
+            std::unique_lock<std::shared_mutex> lock(pImpl->keyPoolsMutex);
+            auto it = pImpl->keyPools.find(context);
+            if (depth == 0)
+            {
+                if (it != pImpl->keyPools.end())
+                {
+                    removed = std::move(it->second);
+                    pImpl->keyPools.erase(it);
+                }
+            }
+            else if (it != pImpl->keyPools.end())
+            {
+                it->second->setDepth(depth);
+            }
+            else
+            {
+                pImpl->keyPools.emplace(context, std::make_shared<KeyPairPool>(algorithm, std::move(generate), depth));
+            }
+        }
+        // The refill thread is joined here, outside the registry lock
+        removed.reset();
+    }
+
+    std::vector<KeyPoolStats> QuantumCrypto::keyPoolStats() const
+    {
+        std::vector<KeyPoolStats> stats;
+        std::shared_lock<std::shared_mutex> lock(pImpl->keyPoolsMutex);
+        for (const auto &entry : pImpl->keyPools)
+        {
+            stats.push_back(entry.second->stats());
+        }
+        return stats;
+    }
+
+    // Signing operation
+    Signature QuantumCrypto::sign(ByteSpan message, ByteSpan privateKey) const
+    {
+        return signMessage(pImpl->sig(pImpl->level()), message, privateKey);
+    }
+
+    Signature QuantumCrypto::sign(SecurityLevel level, ByteSpan message, ByteSpan privateKey) const
+    {
+        return signMessage(pImpl->sig(level), message, privateKey);
+    }
+
+    size_t QuantumCrypto::sign(SecurityLevel level, ByteSpan message, ByteSpan privateKey,
+                               MutableByteSpan signature) const
+    {
+        return signMessage(pImpl->sig(level), message, privateKey, signature);
+    }
+
+    Signature QuantumCrypto::falconSign(FalconVariant variant, ByteSpan message, ByteSpan privateKey) const
+    {
+        return signMessage(pImpl->falcon(variant), message, privateKey);
+    }
+
+    size_t QuantumCrypto::falconSign(FalconVariant variant, ByteSpan message, ByteSpan privateKey,
+                                     MutableByteSpan signature) const
+    {
+        return signMessage(pImpl->falcon(variant), message, privateKey, signature);
+    }
+
+    KeyRegistry::Handle QuantumCrypto::loadPrivateKey(PrivateKey &&key)
+    {
+        return loadPrivateKey(pImpl->level(), std::move(key));
+    }
+
+    KeyRegistry::Handle QuantumCrypto::loadPrivateKey(SecurityLevel level, PrivateKey &&key)
+    {
+        if (key.size() != pImpl->sig(level).length_secret_key)
+        {
+            pImpl->monitor.logFailure("Load Private Key", "Private key length mismatch");
+            throw QuantumError("Invalid private key length");
+        }
+        return pImpl->keys.add(std::move(key), level, KeyAlgorithm::DILITHIUM);
+    }
+
+    KeyRegistry::Handle QuantumCrypto::loadKyberPrivateKey(PrivateKey &&key)
+    {
+        return loadKyberPrivateKey(pImpl->level(), std::move(key));
+    }
+
+    KeyRegistry::Handle QuantumCrypto::loadKyberPrivateKey(SecurityLevel level, PrivateKey &&key)
+    {
+        const OQS_KEM &kem = pImpl->kem(level);
+        if (key.size() != kem.length_secret_key)
+        {
+            pImpl->monitor.logFailure("Load Kyber Private Key", "Private key length mismatch");
+            throw QuantumError("Invalid private key length");
+        }
+        if (!kemKeyHashMatches(kem, key))
+        {
+            pImpl->monitor.logFailure("Load Kyber Private Key", "Embedded public key hash mismatch");
+            throw QuantumError("Corrupt private key");
+        }
+        return pImpl->keys.add(std::move(key), level, KeyAlgorithm::KYBER);
+    }
+
+    bool QuantumCrypto::unloadPrivateKey(KeyRegistry::Handle handle)
+    {
+        return pImpl->keys.remove(handle);
+    }
+
+    Signature QuantumCrypto::signWithHandle(KeyRegistry::Handle handle, const uint8_t *message, size_t length) const
+    {
+        auto entry = pImpl->loadedKey(handle, KeyAlgorithm::DILITHIUM, "Signing");
+        return signMessage(pImpl->sig(entry->level), ByteSpan(message, length), entry->key);
+    }
+
+    SharedSecret QuantumCrypto::decapsulateWithHandle(KeyRegistry::Handle handle, ByteSpan ciphertext) const
+    {
+        auto entry = pImpl->loadedKey(handle, KeyAlgorithm::KYBER, "Kyber Decapsulation");
+        SharedSecret sharedSecret(pImpl->kem(entry->level).length_shared_secret);
+        kyberDecapsulate(entry->level, ciphertext, entry->key, sharedSecret);
+        return sharedSecret;
+    }
+
+    SharedSecret QuantumCrypto::decapsulateBatchWithHandle(KeyRegistry::Handle handle, const ByteSpan *ciphertexts,
+                                                           size_t count) const
+    {
+        auto entry = pImpl->loadedKey(handle, KeyAlgorithm::KYBER, "Batch Kyber Decapsulation");
+        return kyberDecapsulateBatch(entry->level, ciphertexts, count, entry->key);
+    }
+
+    Signature QuantumCrypto::signMessage(const OQS_SIG &sig, ByteSpan message, ByteSpan key, bool prehashed) const
+    {
+        Signature signature(sig.length_signature);
+        size_t length = signMessage(sig, message, key, signature, prehashed);
+        if (length < signature.size())
+        {
+            // Variable-length schemes (Falcon) come in under the maximum
+            return Signature(signature.data(), length);
+        }
+        return signature;
+    }
+
+    size_t QuantumCrypto::signMessage(const OQS_SIG &sig, ByteSpan message, ByteSpan key,
+                                      MutableByteSpan signature, bool prehashed) const
+    {
+        OperationTimer timer(MonitoredOperation::SIGN);
+        auto lock = pImpl->acquire();
+
+        try
+        {
+            validateSecurityLevel();
+            if (key.size() != sig.length_secret_key)
+            {
+                throw QuantumError("Private key length mismatch");
+            }
+            if (signature.size() < sig.length_signature)
+            {
+                throw QuantumError("Signature buffer too small");
+            }
+            if (!prehashed && Prehash::isPrehashMessage(message))
+            {
+                throw QuantumError("Message is reserved for pre-hashed signatures");
+            }
+
+            size_t sigLen = 0;
+
+            int status = OQS_SIG_sign(
+                &sig,
+                signature.data(),
+                &sigLen,
+                message.data(),
+                message.size(),
+                key.data());
+
+            if (status != OQS_SUCCESS)
+            {
+                throw QuantumError("Signing failed");
+            }
+            if (sigLen == 0 || sigLen > sig.length_signature)
+            {
+                throw QuantumError("Unexpected signature length from signing operation");
+            }
+            timer.succeed();
+            return sigLen;
+        }
+        catch (const std::exception &e)
+        {
+            pImpl->monitor.logFailure("Signing", e.what());
+            throw;
+        }
+    }
+
+    // Verification operation
+    bool QuantumCrypto::verify(ByteSpan message, ByteSpan signature, ByteSpan publicKey) const
+    {
+        return verify(pImpl->level(), message, signature, publicKey);
+    }
+
+    bool QuantumCrypto::verify(SecurityLevel level, ByteSpan message, ByteSpan signature, ByteSpan publicKey) const
+    {
+        return verifyMessage(pImpl->sig(level), static_cast<uint8_t>(level), VerifyItem{
+            message.data(), message.size(),
+            signature.data(), signature.size(),
+            publicKey.data(), publicKey.size()});
+    }
+
+    bool QuantumCrypto::falconVerify(FalconVariant variant, ByteSpan message, ByteSpan signature,
+                                     ByteSpan publicKey) const
+    {
+        return verifyMessage(pImpl->falcon(variant), falconCacheScheme(variant), VerifyItem{
+            message.data(), message.size(),
+            signature.data(), signature.size(),
+            publicKey.data(), publicKey.size()});
+    }
+
+    // Streaming signatures
+    Prehash QuantumCrypto::beginPrehash(SecurityLevel level, ByteSpan context) const
+    {
+        return Prehash(pImpl->sig(level), static_cast<uint8_t>(level), context);
+    }
+
+    Prehash QuantumCrypto::beginFalconPrehash(FalconVariant variant, ByteSpan context) const
+    {
+        return Prehash(pImpl->falcon(variant), falconCacheScheme(variant), context);
+    }
+
+    Signature QuantumCrypto::signPrehashed(Prehash &prehash, ByteSpan privateKey) const
+    {
+        uint8_t message[Prehash::MESSAGE_SIZE];
+        prehash.finish(message);
+        return signMessage(*prehash.sig_, ByteSpan(message, sizeof(message)), privateKey, true);
+    }
+
+    bool QuantumCrypto::verifyPrehashed(Prehash &prehash, ByteSpan signature, ByteSpan publicKey) const
+    {
+        uint8_t message[Prehash::MESSAGE_SIZE];
+        prehash.finish(message);
+        return verifyMessage(*prehash.sig_, prehash.cacheScheme_, VerifyItem{
+            message, sizeof(message),
+            signature.data(), signature.size(),
+            publicKey.data(), publicKey.size()});
+    }
+
+    // Single verification: the locking and logging around verifyItem
+    bool QuantumCrypto::verifyMessage(const OQS_SIG &sig, uint8_t cacheScheme, const VerifyItem &item,
+                                      const VerifyCache::Key *publicKeyDigest) const
+    {
+        auto lock = pImpl->acquire();
+
+        try
+        {
+            validateSecurityLevel();
+            return verifyItem(sig, cacheScheme, item, publicKeyDigest);
+        }
+        catch (const std::exception &e)
+        {
+            pImpl->monitor.logFailure("Verify", e.what());
+            throw;
+        }
+    }
+
+    // Prepared public keys
+    PreparedKey QuantumCrypto::preparePublicKey(SecurityLevel level, ByteSpan publicKey)
+    {
+        return prepareKey(pImpl->sig(level), static_cast<uint8_t>(level), publicKey);
+    }
+
+    PreparedKey QuantumCrypto::prepareFalconPublicKey(FalconVariant variant, ByteSpan publicKey)
+    {
+        return prepareKey(pImpl->falcon(variant), falconCacheScheme(variant), publicKey);
+    }
+
+    PreparedKey QuantumCrypto::prepareKey(const OQS_SIG &sig, uint8_t cacheScheme, ByteSpan publicKey)
+    {
+        if (publicKey.size() != sig.length_public_key)
+        {
+            pImpl->monitor.logFailure("Prepare Public Key", "Public key length mismatch");
+            throw QuantumError("Invalid public key length");
+        }
+        return pImpl->preparedKeys.get(cacheScheme, publicKey, [&](const PreparedKeyCache::Fingerprint &fingerprint)
+                                       { return std::make_shared<const PreparedPublicKey>(PreparedPublicKey{
+                                             &sig, cacheScheme, PublicKey(publicKey.data(), publicKey.size()),
+                                             fingerprint,
+                                             pImpl->verifyCache.publicKeyDigest(cacheScheme, publicKey.data(),
+                                                                                publicKey.size())}); });
+    }
 
-        Implementation(const SecurityParams &params)
-            : dilithium(OQS_SIG_new(OQS_SIG_alg_dilithium_5), OQS_SIG_free),
-              kyber(OQS_KEM_new(OQS_KEM_alg_kyber_1024), OQS_KEM_free),
-              securityParams(params)
+    bool QuantumCrypto::verify(const PreparedPublicKey &key, ByteSpan message, ByteSpan signature) const
+    {
+        return verifyMessage(*key.sig, key.cacheScheme, VerifyItem{
+            message.data(), message.size(),
+            signature.data(), signature.size(),
+            key.key.data(), key.key.size()}, &key.cacheDigest);
+    }
+
+    BatchVerifyResult QuantumCrypto::verifyBatch(const PreparedPublicKey &key, const ByteSpan *messages,
+                                                 const ByteSpan *signatures, size_t count, bool earlyAbort) const
+    {
+        std::vector<VerifyItem> items(count);
+        for (size_t i = 0; i < count; ++i)
         {
-            if (!dilithium || !kyber)
-            {
-                throw QuantumError("Failed to initialize quantum algorithms");
-            }
+            items[i] = VerifyItem{messages[i].data(), messages[i].size(),
+                                  signatures[i].data(), signatures[i].size(),
+                                  key.key.data(), key.key.size()};
         }
+        return verifyItems(*key.sig, key.cacheScheme, items.data(), count, earlyAbort, &key.cacheDigest);
+    }
 
-        ~Implementation() = default;
-    };
+    PreparedKeyStats QuantumCrypto::preparedKeyStats() const
+    {
+        return pImpl->preparedKeys.stats();
+    }
 
-    // Destructor implementation for QuantumCrypto
-    QuantumCrypto::~QuantumCrypto() = default;
+    SecureArenaStats QuantumCrypto::secureMemoryStats()
+    {
+        return SecureArena::stats();
+    }
 
-    // Singleton access
-    QuantumCrypto &QuantumCrypto::getInstance(const SecurityParams &params)
+    VerifyCacheStats QuantumCrypto::verifyCacheStats() const
     {
-        // Note: In this singleton design, the first call "wins". Subsequent calls with
-        // different parameters will be ignored.
-        static QuantumCrypto instance(params);
-        return instance;
+        return pImpl->verifyCache.stats();
     }
 
-    // Private constructor
-    QuantumCrypto::QuantumCrypto(const SecurityParams &params)
-        : pImpl(std::make_unique<Implementation>(params))
+    void QuantumCrypto::clearVerifyCache()
     {
-        initializeSecurityMonitor();
+        pImpl->verifyCache.clear();
     }
 
-    // Generate Dilithium Key Pair
-    KeyPair QuantumCrypto::generateDilithiumKeyPair()
+    ThreadPool *QuantumCrypto::workerPool() const
+    {
+        if (!pImpl->securityParams.concurrentExecution)
+        {
+            return nullptr;
+        }
+        return &pImpl->workers();
+    }
+
+    // Batch verification
+    BatchVerifyResult QuantumCrypto::verifyBatch(const std::vector<VerifyItem> &items, bool earlyAbort) const
+    {
+        return verifyBatch(pImpl->level(), items.data(), items.size(), earlyAbort);
+    }
+
+    BatchVerifyResult QuantumCrypto::verifyBatch(const VerifyItem *items, size_t count, bool earlyAbort) const
+    {
+        return verifyBatch(pImpl->level(), items, count, earlyAbort);
+    }
+
+    BatchVerifyResult QuantumCrypto::verifyBatch(SecurityLevel level, const VerifyItem *items, size_t count,
+                                                 bool earlyAbort) const
+    {
+        return verifyItems(pImpl->sig(level), static_cast<uint8_t>(level), items, count, earlyAbort);
+    }
+
+    BatchVerifyResult QuantumCrypto::falconVerifyBatch(FalconVariant variant, const VerifyItem *items, size_t count,
+                                                       bool earlyAbort) const
+    {
+        return verifyItems(pImpl->falcon(variant), falconCacheScheme(variant), items, count, earlyAbort);
+    }
+
+    BatchVerifyResult QuantumCrypto::verifyItems(const OQS_SIG &sig, uint8_t cacheScheme, const VerifyItem *items,
+                                                 size_t count, bool earlyAbort,
+                                                 const VerifyCache::Key *publicKeyDigest) const
     {
-        std::lock_guard<std::mutex> lock(pImpl->mutex);
+        auto lock = pImpl->acquire();
 
         try
         {
             validateSecurityLevel();
-            monitorEntropy();
 
-            SecureBuffer<uint8_t> publicKey(pImpl->dilithium->length_public_key);
-            SecureBuffer<uint8_t> privateKey(pImpl->dilithium->length_secret_key);
+            BatchVerifyResult result;
+            result.count = count;
+            result.bitmap.assign((count + 7) / 8, 0);
+            if (count == 0)
+            {
+                return result;
+            }
 
-            int status = OQS_SIG_keypair(
-                pImpl->dilithium.get(),
-                publicKey.data(),
-                privateKey.data());
+            // One byte per item while workers run so that no two threads
+            // write the same byte; packed into the bitmap afterwards.
+            std::vector<uint8_t> valid(count, 0);
+            std::atomic<bool> abort{false};
 
-            if (status != OQS_SUCCESS)
+            auto verifyOne = [&](size_t index)
+            {
+                if (earlyAbort && abort.load(std::memory_order_relaxed))
+                {
+                    return;
+                }
+                if (verifyItem(sig, cacheScheme, items[index], publicKeyDigest))
+                {
+                    valid[index] = 1;
+                }
+                else if (earlyAbort)
+                {
+                    abort.store(true, std::memory_order_relaxed);
+                }
+            };
+
+            if (pImpl->securityParams.concurrentExecution)
+            {
+                pImpl->workers().parallelFor(count, verifyOne);
+            }
+            else
             {
-                throw QuantumError("Dilithium key generation failed");
+                for (size_t i = 0; i < count; ++i)
+                {
+                    verifyOne(i);
+                }
             }
 
-            return KeyPair{
-                Buffer(publicKey.data(), publicKey.size()),
-                PrivateKey(privateKey.data(), privateKey.size())};
+            for (size_t i = 0; i < count; ++i)
+            {
+                if (valid[i])
+                {
+                    result.bitmap[i / 8] |= static_cast<uint8_t>(1u << (i % 8));
+                    ++result.validCount;
+                }
+            }
+            result.aborted = abort.load();
+            return result;
         }
         catch (const std::exception &e)
         {
-            pImpl->monitor.logFailure("Dilithium Key Generation", e.what());
+            pImpl->monitor.logFailure("Batch Verify", e.what());
             throw;
         }
     }
 
-    // Generate Kyber Key Pair
-    KeyPair QuantumCrypto::generateKyberKeyPair()
+    bool QuantumCrypto::verifyHybrid(SecurityLevel level, const HybridVerifyItem &item) const
+    {
+        return verifyHybridBatch(level, &item, 1).allValid();
+    }
+
+    BatchVerifyResult QuantumCrypto::verifyHybridBatch(SecurityLevel level, const HybridVerifyItem *items,
+                                                       size_t count, bool earlyAbort) const
     {
-        std::lock_guard<std::mutex> lock(pImpl->mutex);
+        auto lock = pImpl->acquire();
 
         try
         {
             validateSecurityLevel();
-            monitorEntropy();
+            const OQS_SIG &sig = pImpl->sig(level);
+            if (!Secp256k1::available())
+            {
+                throw QuantumError("secp256k1 is not available in the linked OpenSSL");
+            }
+            if (count > std::numeric_limits<size_t>::max() / 2)
+            {
+                throw QuantumError("Batch size is too large");
+            }
+
+            BatchVerifyResult result;
+            result.count = count;
+            result.bitmap.assign((count + 7) / 8, 0);
+            if (count == 0)
+            {
+                return result;
+            }
 
-            SecureBuffer<uint8_t> publicKey(pImpl->kyber->length_public_key);
-            SecureBuffer<uint8_t> privateKey(pImpl->kyber->length_secret_key);
+            // Task 2i checks item i's ECDSA half and task 2i + 1 its
+            // Dilithium half; one byte per task as in verifyItems.
+            size_t tasks = count * 2;
+            std::vector<uint8_t> valid(tasks, 0);
+            std::atomic<bool> abort{false};
 
-            int status = OQS_KEM_keypair(
-                pImpl->kyber.get(),
-                publicKey.data(),
-                privateKey.data());
+            auto verifyHalf = [&](size_t task)
+            {
+                if (earlyAbort && abort.load(std::memory_order_relaxed))
+                {
+                    return;
+                }
+                const HybridVerifyItem &item = items[task / 2];
+                bool passed;
+                if (task % 2 == 0)
+                {
+                    passed = Secp256k1::verify(item.message, item.ecdsaSignature, item.ecdsaPublicKey);
+                }
+                else
+                {
+                    VerifyItem quantum{item.message.data(), item.message.size(),
+                                       item.signature.data(), item.signature.size(),
+                                       item.publicKey.data(), item.publicKey.size()};
+                    passed = verifyItem(sig, static_cast<uint8_t>(level), quantum);
+                }
+                if (passed)
+                {
+                    valid[task] = 1;
+                }
+                else if (earlyAbort)
+                {
+                    abort.store(true, std::memory_order_relaxed);
+                }
+            };
 
-            if (status != OQS_SUCCESS)
+            if (pImpl->securityParams.concurrentExecution)
             {
-                throw QuantumError("Kyber key generation failed");
+                pImpl->workers().parallelFor(tasks, verifyHalf);
+            }
+            else
+            {
+                for (size_t i = 0; i < tasks; ++i)
+                {
+                    verifyHalf(i);
+                }
             }
 
-            return KeyPair{
-                Buffer(publicKey.data(), publicKey.size()),
-                PrivateKey(privateKey.data(), privateKey.size())};
+            for (size_t i = 0; i < count; ++i)
+            {
+                if (valid[2 * i] && valid[2 * i + 1])
+                {
+                    result.bitmap[i / 8] |= static_cast<uint8_t>(1u << (i % 8));
+                    ++result.validCount;
+                }
+            }
+            result.aborted = abort.load();
+            return result;
         }
         catch (const std::exception &e)
         {
-            pImpl->monitor.logFailure("Kyber Key Generation", e.what());
+            pImpl->monitor.logFailure("Hybrid Verify", e.what());
             throw;
         }
     }
 
-    // Signing operation
-    Signature QuantumCrypto::sign(const Buffer &message, const PrivateKey &key) const
+    // Single-signature verification shared by verify() and verifyBatch()
+    bool QuantumCrypto::verifyItem(const OQS_SIG &sig, uint8_t cacheScheme, const VerifyItem &item,
+                                   const VerifyCache::Key *publicKeyDigest) const
     {
-        std::lock_guard<std::mutex> lock(pImpl->mutex);
+        // Rejected signatures count as failures
+        OperationTimer timer(MonitoredOperation::VERIFY);
 
-        try
+        // Ensure that the signature and key sizes match the expected lengths.
+        // length_signature is the maximum; only Falcon actually varies.
+        if (item.signatureLength == 0 || item.signatureLength > sig.length_signature)
         {
-            validateSecurityLevel();
+            pImpl->monitor.logFailure("Verify", "Signature length mismatch");
+            return false;
+        }
+        if (item.publicKeyLength != sig.length_public_key)
+        {
+            pImpl->monitor.logFailure("Verify", "Public key length mismatch");
+            return false;
+        }
 
-            SecureBuffer<uint8_t> signature(pImpl->dilithium->length_signature);
-            size_t sigLen;
+        // Verification is deterministic, so a cached outcome for the exact
+        // same bytes stands in for the liboqs call. Known-invalid entries
+        // are dropped without logging to keep replays cheap.
+        VerifyCache &cache = pImpl->verifyCache;
+        VerifyCache::Key key{};
+        if (cache.enabled())
+        {
+            key = publicKeyDigest
+                      ? cache.key(*publicKeyDigest, item.message, item.messageLength,
+                                  item.signature, item.signatureLength)
+                      : cache.key(cacheScheme, item.message, item.messageLength,
+                                  item.signature, item.signatureLength,
+                                  item.publicKey, item.publicKeyLength);
+            bool valid;
+            if (cache.lookup(key, valid))
+            {
+                timer.succeed(valid);
+                return valid;
+            }
+        }
 
-            int status = OQS_SIG_sign(
-                pImpl->dilithium.get(),
-                signature.data(),
-                &sigLen,
-                message.data(),
-                message.size(),
-                key.data());
+        // Perform signature verification using OQS_SIG_verify
+        int status = OQS_SIG_verify(
+            &sig,
+            item.message,
+            item.messageLength,
+            item.signature,
+            item.signatureLength,
+            item.publicKey);
 
-            if (status != OQS_SUCCESS)
+        if (cache.enabled())
+        {
+            cache.insert(key, status == OQS_SUCCESS);
+        }
+
+        if (status != OQS_SUCCESS)
+        {
+            pImpl->monitor.logFailure("Verify", "Signature verification failed");
+            return false;
+        }
+
+        timer.succeed();
+        return true;
+    }
+
+    // Kyber Encapsulation
+    KyberResult QuantumCrypto::kyberEncapsulate(ByteSpan publicKey)
+    {
+        return kyberEncapsulate(pImpl->level(), publicKey);
+    }
+
+    KyberResult QuantumCrypto::kyberEncapsulate(SecurityLevel level, ByteSpan publicKey)
+    {
+        const OQS_KEM &kem = pImpl->kem(level);
+        Buffer ciphertext(kem.length_ciphertext);
+        SharedSecret sharedSecret(kem.length_shared_secret);
+        kyberEncapsulate(level, publicKey, ciphertext, sharedSecret);
+        return KyberResult{std::move(ciphertext), std::move(sharedSecret)};
+    }
+
+    void QuantumCrypto::kyberEncapsulate(SecurityLevel level, ByteSpan publicKey, MutableByteSpan ciphertext,
+                                         MutableByteSpan sharedSecret) const
+    {
+        OperationTimer timer(MonitoredOperation::ENCAPSULATE);
+        auto lock = pImpl->acquire();
+
+        try
+        {
+            validateSecurityLevel();
+            const OQS_KEM &kem = pImpl->kem(level);
+            if (publicKey.size() != kem.length_public_key)
             {
-                throw QuantumError("Signing failed");
+                throw QuantumError("Public key length mismatch");
             }
-            if (sigLen != pImpl->dilithium->length_signature)
+            if (ciphertext.size() != kem.length_ciphertext || sharedSecret.size() != kem.length_shared_secret)
             {
-                throw QuantumError("Unexpected signature length from signing operation");
+                throw QuantumError("Output buffer length mismatch");
+            }
+
+            int status = OQS_KEM_encaps(
+                &kem,
+                ciphertext.data(),
+                sharedSecret.data(),
+                publicKey.data());
+
+            if (status != OQS_SUCCESS)
+            {
+                throw QuantumError("Kyber encapsulation failed");
             }
 
-            return Signature(signature.data(), sigLen);
+            timer.succeed();
         }
         catch (const std::exception &e)
         {
-            pImpl->monitor.logFailure("Signing", e.what());
+            pImpl->monitor.logFailure("Kyber Encapsulation", e.what());
             throw;
         }
     }
 
-    // Verification operation
-    bool QuantumCrypto::verify(const Buffer &message, const Signature &signature, const PublicKey &key) const
+    // Kyber Decapsulation
+    SharedSecret QuantumCrypto::kyberDecapsulate(ByteSpan ciphertext, ByteSpan privateKey)
+    {
+        return kyberDecapsulate(pImpl->level(), ciphertext, privateKey);
+    }
+
+    SharedSecret QuantumCrypto::kyberDecapsulate(SecurityLevel level, ByteSpan ciphertext, ByteSpan privateKey)
+    {
+        SharedSecret sharedSecret(pImpl->kem(level).length_shared_secret);
+        kyberDecapsulate(level, ciphertext, privateKey, sharedSecret);
+        return sharedSecret;
+    }
+
+    void QuantumCrypto::kyberDecapsulate(SecurityLevel level, ByteSpan ciphertext, ByteSpan privateKey,
+                                         MutableByteSpan sharedSecret) const
     {
-        std::lock_guard<std::mutex> lock(pImpl->mutex);
+        OperationTimer timer(MonitoredOperation::DECAPSULATE);
+        auto lock = pImpl->acquire();
 
         try
         {
             validateSecurityLevel();
-
-            // Ensure that the signature size matches the expected length
-            if (signature.size() != pImpl->dilithium->length_signature)
+            const OQS_KEM &kem = pImpl->kem(level);
+            if (ciphertext.size() != kem.length_ciphertext)
             {
-                pImpl->monitor.logFailure("Verify", "Signature length mismatch");
-                return false;
+                throw QuantumError("Ciphertext length mismatch");
+            }
+            if (privateKey.size() != kem.length_secret_key)
+            {
+                throw QuantumError("Private key length mismatch");
+            }
+            if (sharedSecret.size() != kem.length_shared_secret)
+            {
+                throw QuantumError("Output buffer length mismatch");
             }
 
-            // Perform signature verification using OQS_SIG_verify
-            int status = OQS_SIG_verify(
-                pImpl->dilithium.get(),
-                message.data(),
-                message.size(),
-                signature.data(),
-                signature.size(),
-                key.data());
+            int status = OQS_KEM_decaps(
+                &kem,
+                sharedSecret.data(),
+                ciphertext.data(),
+                privateKey.data());
 
             if (status != OQS_SUCCESS)
             {
-                pImpl->monitor.logFailure("Verify", "Signature verification failed");
-                return false;
+                throw QuantumError("Kyber decapsulation failed");
             }
 
-            return true;
+            timer.succeed();
         }
         catch (const std::exception &e)
         {
-            pImpl->monitor.logFailure("Verify", e.what());
+            pImpl->monitor.logFailure("Kyber Decapsulation", e.what());
             throw;
         }
     }
 
-    // Kyber Encapsulation
-    KyberResult QuantumCrypto::kyberEncapsulate(const PublicKey &key)
+    // Batch KEM
+    KyberBatch QuantumCrypto::kyberEncapsulateBatch(const ByteSpan *publicKeys, size_t count)
+    {
+        return kyberEncapsulateBatch(pImpl->level(), publicKeys, count);
+    }
+
+    KyberBatch QuantumCrypto::kyberEncapsulateBatch(SecurityLevel level, const ByteSpan *publicKeys,
+                                                    size_t count) const
     {
-        std::lock_guard<std::mutex> lock(pImpl->mutex);
+        auto lock = pImpl->acquire();
 
         try
         {
+            if (count == 0)
+            {
+                throw QuantumError("Batch size must be positive");
+            }
             validateSecurityLevel();
+            const OQS_KEM &kem = pImpl->kem(level);
+            for (size_t i = 0; i < count; ++i)
+            {
+                if (publicKeys[i].size() != kem.length_public_key)
+                {
+                    throw QuantumError("Public key length mismatch at index " + std::to_string(i));
+                }
+            }
+            if (count > std::numeric_limits<size_t>::max() / kem.length_ciphertext)
+            {
+                throw QuantumError("Batch size is too large");
+            }
 
-            SecureBuffer<uint8_t> ciphertext(pImpl->kyber->length_ciphertext);
-            SecureBuffer<uint8_t> sharedSecret(pImpl->kyber->length_shared_secret);
+            KyberBatch batch{count, kem.length_ciphertext, kem.length_shared_secret,
+                             Buffer(count * kem.length_ciphertext),
+                             SharedSecret(count * kem.length_shared_secret)};
+            uint8_t *ciphertexts = batch.ciphertexts.data();
+            uint8_t *sharedSecrets = batch.sharedSecrets.data();
 
-            int status = OQS_KEM_encaps(
-                pImpl->kyber.get(),
-                ciphertext.data(),
-                sharedSecret.data(),
-                key.data());
+            std::atomic<bool> failed{false};
+            auto encapsulateOne = [&](size_t index)
+            {
+                if (failed.load(std::memory_order_relaxed))
+                {
+                    return;
+                }
+                OperationTimer timer(MonitoredOperation::ENCAPSULATE);
+                if (OQS_KEM_encaps(&kem,
+                                   ciphertexts + index * kem.length_ciphertext,
+                                   sharedSecrets + index * kem.length_shared_secret,
+                                   publicKeys[index].data()) != OQS_SUCCESS)
+                {
+                    failed.store(true, std::memory_order_relaxed);
+                    return;
+                }
+                timer.succeed();
+            };
 
-            if (status != OQS_SUCCESS)
+            if (pImpl->securityParams.concurrentExecution)
             {
-                throw QuantumError("Kyber encapsulation failed");
+                pImpl->workers().parallelFor(count, encapsulateOne);
+            }
+            else
+            {
+                for (size_t i = 0; i < count; ++i)
+                {
+                    encapsulateOne(i);
+                }
             }
 
-            return KyberResult{
-                Buffer(ciphertext.data(), ciphertext.size()),
-                SharedSecret(sharedSecret.data(), sharedSecret.size())};
+            if (failed.load())
+            {
+                throw QuantumError("Kyber batch encapsulation failed");
+            }
+            return batch;
         }
         catch (const std::exception &e)
         {
-            pImpl->monitor.logFailure("Kyber Encapsulation", e.what());
+            pImpl->monitor.logFailure("Batch Kyber Encapsulation", e.what());
             throw;
         }
     }
 
-    // Kyber Decapsulation
-    SharedSecret QuantumCrypto::kyberDecapsulate(const Buffer &ciphertext, const PrivateKey &key)
+    SharedSecret QuantumCrypto::kyberDecapsulateBatch(const ByteSpan *ciphertexts, size_t count,
+                                                      ByteSpan privateKey)
+    {
+        return kyberDecapsulateBatch(pImpl->level(), ciphertexts, count, privateKey);
+    }
+
+    SharedSecret QuantumCrypto::kyberDecapsulateBatch(SecurityLevel level, const ByteSpan *ciphertexts,
+                                                      size_t count, ByteSpan privateKey) const
     {
-        std::lock_guard<std::mutex> lock(pImpl->mutex);
+        auto lock = pImpl->acquire();
 
         try
         {
+            if (count == 0)
+            {
+                throw QuantumError("Batch size must be positive");
+            }
             validateSecurityLevel();
+            const OQS_KEM &kem = pImpl->kem(level);
+            if (privateKey.size() != kem.length_secret_key)
+            {
+                throw QuantumError("Private key length mismatch");
+            }
+            for (size_t i = 0; i < count; ++i)
+            {
+                if (ciphertexts[i].size() != kem.length_ciphertext)
+                {
+                    throw QuantumError("Ciphertext length mismatch at index " + std::to_string(i));
+                }
+            }
+            if (count > std::numeric_limits<size_t>::max() / kem.length_shared_secret)
+            {
+                throw QuantumError("Batch size is too large");
+            }
 
-            SecureBuffer<uint8_t> sharedSecret(pImpl->kyber->length_shared_secret);
+            SharedSecret sharedSecrets(count * kem.length_shared_secret);
+            uint8_t *out = sharedSecrets.data();
 
-            int status = OQS_KEM_decaps(
-                pImpl->kyber.get(),
-                sharedSecret.data(),
-                ciphertext.data(),
-                key.data());
+            std::atomic<bool> failed{false};
+            auto decapsulateOne = [&](size_t index)
+            {
+                if (failed.load(std::memory_order_relaxed))
+                {
+                    return;
+                }
+                OperationTimer timer(MonitoredOperation::DECAPSULATE);
+                if (OQS_KEM_decaps(&kem,
+                                   out + index * kem.length_shared_secret,
+                                   ciphertexts[index].data(),
+                                   privateKey.data()) != OQS_SUCCESS)
+                {
+                    failed.store(true, std::memory_order_relaxed);
+                    return;
+                }
+                timer.succeed();
+            };
 
-            if (status != OQS_SUCCESS)
+            if (pImpl->securityParams.concurrentExecution)
             {
-                throw QuantumError("Kyber decapsulation failed");
+                pImpl->workers().parallelFor(count, decapsulateOne);
+            }
+            else
+            {
+                for (size_t i = 0; i < count; ++i)
+                {
+                    decapsulateOne(i);
+                }
             }
 
-            return SharedSecret(sharedSecret.data(), sharedSecret.size());
+            if (failed.load())
+            {
+                throw QuantumError("Kyber batch decapsulation failed");
+            }
+            return sharedSecrets;
         }
         catch (const std::exception &e)
         {
-            pImpl->monitor.logFailure("Kyber Decapsulation", e.what());
+            pImpl->monitor.logFailure("Batch Kyber Decapsulation", e.what());
             throw;
         }
     }
@@ -273,39 +1531,97 @@ namespace quantum
     Buffer QuantumCrypto::generateSecureRandom(size_t length) const
     {
         Buffer result(length);
-        if (RAND_bytes(result.data(), length) != 1)
+        try
+        {
+            pImpl->entropy.fill(result.data(), length);
+        }
+        catch (const std::exception &e)
         {
+            pImpl->monitor.logFailure("Random Generation", e.what());
             throw QuantumError("Failed to generate secure random bytes");
         }
         return result;
     }
 
+    SecurityLogStats QuantumCrypto::securityLogStats() const
+    {
+        return pImpl->monitor.logStats();
+    }
+
+    EntropyStats QuantumCrypto::entropyStats() const
+    {
+        return pImpl->entropy.stats();
+    }
+
     // Health Check
     bool QuantumCrypto::healthCheck()
     {
-        try
-        {
-            if (!pImpl->entropy.hasGoodQuality())
-            {
-                return false;
-            }
+        return pImpl->health->run() == 0;
+    }
 
-            KeyPair testKeyPair = generateDilithiumKeyPair();
-            Buffer testMessage = generateSecureRandom(32);
-            Signature testSig = sign(testMessage, PrivateKey(testKeyPair.privateKey.data(), testKeyPair.privateKey.size()));
+    HealthStatus QuantumCrypto::healthStatus() const
+    {
+        return pImpl->health->status();
+    }
 
-            if (!verify(testMessage, testSig, PublicKey(testKeyPair.publicKey.data(), testKeyPair.publicKey.size())))
+    // Runs on the health thread (or a healthCheck() caller). Calls liboqs
+    // directly on the immutable contexts, so it takes none of the locks,
+    // caches or counters used by sign/verify/KEM.
+    uint32_t QuantumCrypto::runKnownAnswerTests() const
+    {
+        KnownAnswers &answers = pImpl->knownAnswers;
+        std::call_once(pImpl->knownAnswersInit, [this, &answers]()
+                       {
+            for (size_t i = 0; i < SECURITY_LEVEL_COUNT; ++i)
             {
-                return false;
+                makeSignatureVector(pImpl->schemes[i].sig.get(), answers.signatures[i]);
+                makeKemVector(pImpl->schemes[i].kem.get(), answers.kems[i]);
             }
+            for (size_t i = 0; i < FALCON_VARIANT_COUNT; ++i)
+            {
+                makeSignatureVector(pImpl->falconSigs[i].get(), answers.falcon[i]);
+            } });
 
-            checkForSideChannels();
-            return true;
+        uint32_t failures = 0;
+        // Parameter sets missing from liboqs are skipped, not failed
+        for (size_t i = 0; i < SECURITY_LEVEL_COUNT; ++i)
+        {
+            if (pImpl->schemes[i].sig && !checkSignatureVector(answers.signatures[i]))
+            {
+                failures |= HEALTH_SIGNATURE << i;
+            }
+            if (pImpl->schemes[i].kem && !checkKemVector(answers.kems[i]))
+            {
+                failures |= HEALTH_KEM << i;
+            }
         }
-        catch (...)
+        for (size_t i = 0; i < FALCON_VARIANT_COUNT; ++i)
         {
-            return false;
+            if (pImpl->falconSigs[i] && !checkSignatureVector(answers.falcon[i]))
+            {
+                failures |= HEALTH_FALCON << i;
+            }
+        }
+        if (!checkSha3())
+        {
+            failures |= HEALTH_HASH;
+        }
+        if (!pImpl->entropy.hasGoodQuality())
+        {
+            failures |= HEALTH_ENTROPY;
+        }
+        if (!pImpl->monitor.isSecurityLevelMaintained() || pImpl->monitor.detectSideChannelVulnerability())
+        {
+            failures |= HEALTH_MONITOR;
+        }
+
+        if (failures != 0)
+        {
+            char text[64];
+            std::snprintf(text, sizeof(text), "Known-answer tests failed (0x%08x)", failures);
+            pImpl->monitor.logFailure("Health Check", text);
         }
+        return failures;
     }
 
     // Validate Security Level
@@ -3,8 +3,18 @@
 #include <oqs/oqs.h>
 #include <openssl/crypto.h>
 #include <memory>
+#include <stdexcept>
 #include <string>
+#include <vector>
 #include "memory.h"
+#include "verify_cache.h"
+#include "key_registry.h"
+#include "keypair_pool.h"
+#include "entropy_pool.h"
+#include "security_monitor.h"
+#include "health_monitor.h"
+#include "prehash.h"
+#include "prepared_keys.h"
 
 namespace quantum
 {
@@ -15,6 +25,7 @@ namespace quantum
     class PublicKey;
     class Signature;
     class SharedSecret;
+    class ThreadPool;
 
     // Exception class for quantum-related errors
     class QuantumError : public std::runtime_error
@@ -23,6 +34,44 @@ namespace quantum
         explicit QuantumError(const std::string &msg) : std::runtime_error(msg) {}
     };
 
+    // Post-quantum parameter sets, numbered like types.ts SecurityLevel.
+    // LEGACY is the round-3 Dilithium5 / Kyber1024 pair used by every key
+    // and signature created before parameter sets became selectable.
+    enum class SecurityLevel : uint32_t
+    {
+        LEGACY = 0,
+        NORMAL = 1,   // ML-DSA-44 / ML-KEM-512
+        HIGH = 2,     // ML-DSA-65 / ML-KEM-768
+        PARANOID = 3, // ML-DSA-87 / ML-KEM-1024
+    };
+    constexpr size_t SECURITY_LEVEL_COUNT = 4;
+
+    // Falcon variants, offered next to the ML-DSA family for traffic where
+    // signature and key size dominate. Signatures are variable length up to
+    // the variant's maximum.
+    enum class FalconVariant : uint32_t
+    {
+        FALCON_512 = 0,  // NIST level 1
+        FALCON_1024 = 1, // NIST level 5
+    };
+    constexpr size_t FALCON_VARIANT_COUNT = 2;
+
+    // Algorithm names and sizes of one parameter set
+    struct ParameterSetInfo
+    {
+        SecurityLevel level;
+        bool available; // false when liboqs was built without it
+        const char *signatureAlgorithm;
+        const char *kemAlgorithm;
+        size_t publicKeyLength;
+        size_t privateKeyLength;
+        size_t signatureLength;
+        size_t kemPublicKeyLength;
+        size_t kemPrivateKeyLength;
+        size_t ciphertextLength;
+        size_t sharedSecretLength;
+    };
+
     // Security parameters structure
     struct SecurityParams
     {
@@ -30,6 +79,28 @@ namespace quantum
         uint32_t entropyQuality{256}; // Bits of entropy required
         uint32_t securityLevel{256};  // Security level in bits
         bool sidechannelProtection{true};
+        // When false, every operation is serialized behind a single mutex
+        // (legacy behaviour). The liboqs contexts are immutable after
+        // construction, so concurrent mode runs sign/verify/KEM without a lock.
+        bool concurrentExecution{true};
+        // Size of the native worker pool used by batch operations
+        // (0 = one thread per hardware core; the addon instead gives it the
+        // cores its async dispatcher does not use).
+        uint32_t workerThreads{0};
+        // Entries in the verification result cache (0 disables it).
+        size_t verifyCacheEntries{65536};
+        // Prepared public keys kept for repeat signers (0 disables it).
+        size_t preparedKeyEntries{4096};
+        // OpenSSL secure heap reserved at startup for private keys and
+        // shared secrets (rounded up to a power of two; 0 leaves it
+        // unmanaged). Public data never draws from it, and a full heap
+        // falls back to ordinary memory, counted in secureMemoryStats().
+        size_t secureHeapBytes{size_t(1) << 21};
+        // Parameter set used by calls that do not name one.
+        SecurityLevel defaultLevel{SecurityLevel::LEGACY};
+        // Period of the background known-answer health check (0 disables
+        // the thread; healthCheck() still runs it on demand).
+        uint32_t healthCheckIntervalMs{60000};
     };
 
     // Key pair structure
@@ -39,6 +110,37 @@ namespace quantum
         Buffer privateKey;
     };
 
+    // Algorithms accepted by batch key generation
+    enum class KeyAlgorithm : uint32_t
+    {
+        DILITHIUM = 0,
+        KYBER = 1,
+    };
+
+    // Result of a batch key generation. Key pair i occupies
+    // [i * publicKeyLength, (i + 1) * publicKeyLength) of publicKeys and the
+    // matching slice of privateKeys; one allocation holds each side. Both
+    // are ordinary memory: a batch can be larger than the whole secure heap
+    // and is copied out to JS as soon as it is generated.
+    struct KeyPairBatch
+    {
+        size_t count;
+        size_t publicKeyLength;
+        size_t privateKeyLength;
+        Buffer publicKeys;
+        Buffer privateKeys;
+
+        const uint8_t *publicKey(size_t index) const
+        {
+            return publicKeys.data() + index * publicKeyLength;
+        }
+
+        const uint8_t *privateKey(size_t index) const
+        {
+            return privateKeys.data() + index * privateKeyLength;
+        }
+    };
+
     // Kyber encapsulation result structure
     struct KyberResult
     {
@@ -46,6 +148,74 @@ namespace quantum
         Buffer sharedSecret;
     };
 
+    // Result of a batch encapsulation. Item i's ciphertext occupies
+    // [i * ciphertextLength, (i + 1) * ciphertextLength) of ciphertexts and
+    // its shared secret the matching slice of sharedSecrets.
+    struct KyberBatch
+    {
+        size_t count;
+        size_t ciphertextLength;
+        size_t sharedSecretLength;
+        Buffer ciphertexts;
+        SharedSecret sharedSecrets;
+
+        const uint8_t *ciphertext(size_t index) const
+        {
+            return ciphertexts.data() + index * ciphertextLength;
+        }
+
+        const uint8_t *sharedSecret(size_t index) const
+        {
+            return sharedSecrets.data() + index * sharedSecretLength;
+        }
+    };
+
+    // One entry of a batch verification. The pointers are borrowed for the
+    // duration of the call and are not copied into secure memory.
+    struct VerifyItem
+    {
+        const uint8_t *message;
+        size_t messageLength;
+        const uint8_t *signature;
+        size_t signatureLength;
+        const uint8_t *publicKey;
+        size_t publicKeyLength;
+    };
+
+    // One entry of a hybrid verification. The message carries two
+    // signatures that must both verify: secp256k1 ECDSA over its SHA-256
+    // digest (DER signature, SEC1 public key) and Dilithium over the message
+    // itself. Borrowed for the duration of the call, like VerifyItem.
+    struct HybridVerifyItem
+    {
+        ByteSpan message;
+        ByteSpan ecdsaSignature;
+        ByteSpan ecdsaPublicKey;
+        ByteSpan signature;
+        ByteSpan publicKey;
+    };
+
+    // Result of a batch verification. Bit i of the bitmap (LSB first) is set
+    // when item i verified. In early-abort mode items that were never
+    // attempted are left cleared and `aborted` is set.
+    struct BatchVerifyResult
+    {
+        std::vector<uint8_t> bitmap;
+        size_t count{0};
+        size_t validCount{0};
+        bool aborted{false};
+
+        bool isValid(size_t index) const
+        {
+            return (bitmap[index / 8] >> (index % 8)) & 1;
+        }
+
+        bool allValid() const
+        {
+            return validCount == count;
+        }
+    };
+
     // QuantumCrypto class managing quantum-resistant cryptographic operations
     class QuantumCrypto
     {
@@ -62,93 +232,185 @@ namespace quantum
         // Destructor
         ~QuantumCrypto();
 
+        // Parameter sets. Every parameter set has its own liboqs contexts,
+        // so all of them can be used at once; operations that do not name a
+        // level use the process default set here.
+        void setSecurityLevel(SecurityLevel level);
+        SecurityLevel securityLevel() const;
+        ParameterSetInfo parameterSet(SecurityLevel level) const;
+
         // Core cryptographic operations
         KeyPair generateDilithiumKeyPair();
+        KeyPair generateDilithiumKeyPair(SecurityLevel level);
         KeyPair generateKyberKeyPair();
+        KeyPair generateKyberKeyPair(SecurityLevel level);
 
-        // Signing operations
-        Signature sign(const Buffer &message, const PrivateKey &key) const;
-        bool verify(const Buffer &message, const Signature &signature, const PublicKey &key) const;
+        // Bulk provisioning: count key pairs generated across the worker
+        // pool into one contiguous region per side. Entropy is checked once
+        // for the whole batch and the key pools are bypassed.
+        KeyPairBatch generateKeyPairsBatch(KeyAlgorithm algorithm, size_t count);
+        KeyPairBatch generateKeyPairsBatch(KeyAlgorithm algorithm, SecurityLevel level, size_t count);
 
-        // KEM operations
-        KyberResult kyberEncapsulate(const PublicKey &key);
-        SharedSecret kyberDecapsulate(const Buffer &ciphertext, const PrivateKey &key);
+        // Signing operations. Inputs are views, so a Buffer, a vector or a
+        // pointer and length are read in place. The forms taking an output
+        // view allocate nothing: sign writes into a buffer of at least
+        // parameterSet(level).signatureLength bytes and returns the length.
+        Signature sign(ByteSpan message, ByteSpan privateKey) const;
+        Signature sign(SecurityLevel level, ByteSpan message, ByteSpan privateKey) const;
+        size_t sign(SecurityLevel level, ByteSpan message, ByteSpan privateKey, MutableByteSpan signature) const;
+        bool verify(ByteSpan message, ByteSpan signature, ByteSpan publicKey) const;
+        bool verify(SecurityLevel level, ByteSpan message, ByteSpan signature, ByteSpan publicKey) const;
 
-        // Random number generation
-        Buffer generateSecureRandom(size_t length) const;
+        // Streaming sign/verify: begin a Prehash, feed it the message in
+        // pieces with update(), then hand it to signPrehashed or
+        // verifyPrehashed, which consume it. Memory use is constant in the
+        // message length. The context string (at most 255 bytes) separates
+        // applications; sign and verify must use the same one.
+        Prehash beginPrehash(SecurityLevel level, ByteSpan context = ByteSpan()) const;
+        Prehash beginFalconPrehash(FalconVariant variant, ByteSpan context = ByteSpan()) const;
+        Signature signPrehashed(Prehash &prehash, ByteSpan privateKey) const;
+        bool verifyPrehashed(Prehash &prehash, ByteSpan signature, ByteSpan publicKey) const;
 
-        // Health and security monitoring
-        bool healthCheck();
-        void validateSecurityLevel() const;
-        void checkForSideChannels() const;
+        // Keep a Dilithium private key in native secure memory and sign with
+        // it by handle. The key is validated and moved into the registry,
+        // which remembers its parameter set.
+        KeyRegistry::Handle loadPrivateKey(PrivateKey &&key);
+        KeyRegistry::Handle loadPrivateKey(SecurityLevel level, PrivateKey &&key);
+        bool unloadPrivateKey(KeyRegistry::Handle handle);
+        Signature signWithHandle(KeyRegistry::Handle handle, const uint8_t *message, size_t length) const;
 
-    private:
-        // Private constructor accepts security parameters (optional improvement)
-        explicit QuantumCrypto(const SecurityParams &params = SecurityParams::DEFAULT);
-        // PIMPL idiom
-        struct Implementation;
-        std::unique_ptr<Implementation> pImpl;
+        // The Kyber counterpart, for nodes that accept many handshakes under
+        // one long-lived key. Loading checks the key once (length, and the
+        // FIPS 203 hash check of the embedded public key); every thread then
+        // decapsulates against the same copy. unloadPrivateKey releases it.
+        KeyRegistry::Handle loadKyberPrivateKey(PrivateKey &&key);
+        KeyRegistry::Handle loadKyberPrivateKey(SecurityLevel level, PrivateKey &&key);
+        SharedSecret decapsulateWithHandle(KeyRegistry::Handle handle, ByteSpan ciphertext) const;
+        SharedSecret decapsulateBatchWithHandle(KeyRegistry::Handle handle, const ByteSpan *ciphertexts,
+                                                size_t count) const;
 
-        // Internal methods
-        void monitorEntropy();
-        void initializeSecurityMonitor();
-    };
+        // Background key pair pools, one per algorithm. While a pool has a
+        // non-zero depth the matching generate*KeyPair call takes from it
+        // and only generates on demand when it is empty; depth 0 stops it.
+        void setDilithiumKeyPoolDepth(SecurityLevel level, size_t depth);
+        void setKyberKeyPoolDepth(SecurityLevel level, size_t depth);
+        void setFalconKeyPoolDepth(FalconVariant variant, size_t depth);
+        std::vector<KeyPoolStats> keyPoolStats() const;
 
-    // Buffer classes with secure memory handling
+        // Falcon signatures
+        KeyPair generateFalconKeyPair(FalconVariant variant = FalconVariant::FALCON_512);
+        Signature falconSign(FalconVariant variant, ByteSpan message, ByteSpan privateKey) const;
+        size_t falconSign(FalconVariant variant, ByteSpan message, ByteSpan privateKey,
+                          MutableByteSpan signature) const;
+        bool falconVerify(FalconVariant variant, ByteSpan message, ByteSpan signature, ByteSpan publicKey) const;
+        BatchVerifyResult falconVerifyBatch(FalconVariant variant, const VerifyItem *items, size_t count,
+                                            bool earlyAbort = false) const;
 
-    // Base Buffer class inheriting from SecureBuffer<uint8_t>
-    class Buffer : public SecureBuffer<uint8_t>
-    {
-    public:
-        explicit Buffer(size_t size);
-        Buffer(const uint8_t *data, size_t size);
+        // Batch verification fanned out over the native worker pool. With
+        // earlyAbort set, the batch stops at the first invalid signature,
+        // which is all block validation needs to reject a block.
+        BatchVerifyResult verifyBatch(const VerifyItem *items, size_t count, bool earlyAbort = false) const;
+        BatchVerifyResult verifyBatch(SecurityLevel level, const VerifyItem *items, size_t count,
+                                      bool earlyAbort = false) const;
+        BatchVerifyResult verifyBatch(const std::vector<VerifyItem> &items, bool earlyAbort = false) const;
 
-        // Convert buffer to Base64 string
-        std::string toBase64() const;
+        // Verification against a signer seen many times: the key is
+        // validated and digested once by prepare*, and verifications then
+        // only hash the message and signature for the verify cache.
+        // Prepared keys are cached by fingerprint, so preparing a known key
+        // again is a lookup.
+        PreparedKey preparePublicKey(SecurityLevel level, ByteSpan publicKey);
+        PreparedKey prepareFalconPublicKey(FalconVariant variant, ByteSpan publicKey);
+        bool verify(const PreparedPublicKey &key, ByteSpan message, ByteSpan signature) const;
+        BatchVerifyResult verifyBatch(const PreparedPublicKey &key, const ByteSpan *messages,
+                                      const ByteSpan *signatures, size_t count, bool earlyAbort = false) const;
+        PreparedKeyStats preparedKeyStats() const;
 
-        // Create Buffer from Base64 string
-        static Buffer fromBase64(const std::string &base64);
+        // Hybrid ECDSA + Dilithium verification. The ECDSA and Dilithium
+        // halves are separate worker pool tasks, so the two halves of one
+        // item run concurrently; an item is valid only when both pass.
+        bool verifyHybrid(SecurityLevel level, const HybridVerifyItem &item) const;
+        BatchVerifyResult verifyHybridBatch(SecurityLevel level, const HybridVerifyItem *items, size_t count,
+                                            bool earlyAbort = false) const;
 
-        // Secure zeroing
-        void zeroize();
-    };
+        // Secure heap usage, for sizing secureHeapBytes in production.
+        static SecureArenaStats secureMemoryStats();
 
-    // PrivateKey class inheriting from Buffer
-    class PrivateKey : public Buffer
-    {
-    public:
-        using Buffer::Buffer;
+        // Counters of the asynchronous security failure log.
+        SecurityLogStats securityLogStats() const;
 
-        void zeroize();
-    };
+        // Verification cache counters; clearing drops entries, not counters.
+        VerifyCacheStats verifyCacheStats() const;
+        void clearVerifyCache();
 
-    // PublicKey class inheriting from Buffer
-    class PublicKey : public Buffer
-    {
-    public:
-        using Buffer::Buffer;
+        // Shared worker pool for native batch engines (Merkle, hashing).
+        // Returns nullptr when concurrent execution is disabled.
+        ThreadPool *workerPool() const;
 
-        // Generate fingerprint using SHA-256
-        std::string getFingerprint() const;
-    };
+        // KEM operations. The forms taking output views allocate nothing;
+        // ciphertext and sharedSecret must be exactly the parameter set's sizes.
+        KyberResult kyberEncapsulate(ByteSpan publicKey);
+        KyberResult kyberEncapsulate(SecurityLevel level, ByteSpan publicKey);
+        void kyberEncapsulate(SecurityLevel level, ByteSpan publicKey, MutableByteSpan ciphertext,
+                              MutableByteSpan sharedSecret) const;
+        SharedSecret kyberDecapsulate(ByteSpan ciphertext, ByteSpan privateKey);
+        SharedSecret kyberDecapsulate(SecurityLevel level, ByteSpan ciphertext, ByteSpan privateKey);
+        void kyberDecapsulate(SecurityLevel level, ByteSpan ciphertext, ByteSpan privateKey,
+                              MutableByteSpan sharedSecret) const;
 
-    // Signature class inheriting from Buffer
-    class Signature : public Buffer
-    {
-    public:
-        using Buffer::Buffer;
+        // Batch KEM for many peers at once: the items run across the worker
+        // pool and write into one contiguous region per output. Every input
+        // is checked before any work starts; a bad one fails the batch.
+        // Decapsulation returns count shared secrets back to back.
+        KyberBatch kyberEncapsulateBatch(const ByteSpan *publicKeys, size_t count);
+        KyberBatch kyberEncapsulateBatch(SecurityLevel level, const ByteSpan *publicKeys, size_t count) const;
+        SharedSecret kyberDecapsulateBatch(const ByteSpan *ciphertexts, size_t count, ByteSpan privateKey);
+        SharedSecret kyberDecapsulateBatch(SecurityLevel level, const ByteSpan *ciphertexts, size_t count,
+                                           ByteSpan privateKey) const;
 
-        // Check if the signature is valid
-        bool isValid() const;
-    };
+        // Random number generation, served by the per-thread DRBGs
+        Buffer generateSecureRandom(size_t length) const;
+        EntropyStats entropyStats() const;
 
-    // SharedSecret class inheriting from Buffer
-    class SharedSecret : public Buffer
-    {
-    public:
-        using Buffer::Buffer;
+        // Health and security monitoring. healthCheck() runs the
+        // known-answer tests on the calling thread; healthStatus() returns
+        // the result of the latest run without running anything.
+        bool healthCheck();
+        HealthStatus healthStatus() const;
+        void validateSecurityLevel() const;
+        void checkForSideChannels() const;
 
-        void zeroize();
+    private:
+        // Private constructor accepts security parameters (optional improvement)
+        explicit QuantumCrypto(const SecurityParams &params = SecurityParams::DEFAULT);
+        // PIMPL idiom
+        struct Implementation;
+        std::unique_ptr<Implementation> pImpl;
+
+        // Internal methods
+        // Shared by the Dilithium and Falcon paths. cacheScheme separates
+        // the schemes' entries in the verify cache.
+        KeyPair generateSignatureKeyPair(const OQS_SIG &sig, const char *operation);
+        KeyPair generateKemKeyPair(const OQS_KEM &kem);
+        void setKeyPoolDepth(const void *context, const char *algorithm, KeyPairPool::Generator generate,
+                             size_t depth);
+        // prehashed is set only for the encoded digest from signPrehashed;
+        // other messages in the pre-hash domain are refused.
+        size_t signMessage(const OQS_SIG &sig, ByteSpan message, ByteSpan key, MutableByteSpan signature,
+                           bool prehashed = false) const;
+        Signature signMessage(const OQS_SIG &sig, ByteSpan message, ByteSpan key, bool prehashed = false) const;
+        bool verifyMessage(const OQS_SIG &sig, uint8_t cacheScheme, const VerifyItem &item,
+                           const VerifyCache::Key *publicKeyDigest = nullptr) const;
+        PreparedKey prepareKey(const OQS_SIG &sig, uint8_t cacheScheme, ByteSpan publicKey);
+        // publicKeyDigest, when given, is the prepared key's stand-in in
+        // verify cache keys
+        bool verifyItem(const OQS_SIG &sig, uint8_t cacheScheme, const VerifyItem &item,
+                        const VerifyCache::Key *publicKeyDigest = nullptr) const;
+        BatchVerifyResult verifyItems(const OQS_SIG &sig, uint8_t cacheScheme, const VerifyItem *items, size_t count,
+                                      bool earlyAbort, const VerifyCache::Key *publicKeyDigest = nullptr) const;
+        uint32_t runKnownAnswerTests() const;
+        void monitorEntropy();
+        void initializeSecurityMonitor();
     };
 
 } // namespace quantum
\ No newline at end of file
@@ -1,8 +1,36 @@
 import {
   NativeQuantum,
   QuantumKeyPair,
+  KeyPairAlgorithm,
+  KeyPairBatch,
   KyberEncapsulation,
+  KyberEncapsulationBatch,
   SecurityLevel,
+  HashAlgorithm,
+  NativeMiningOptions,
+  NativeMiningResult,
+  NativeMerkleTree,
+  NativeMerkleProof,
+  VerifyCacheStats,
+  SecureMemoryStats,
+  EntropyStats,
+  SecurityLogStats,
+  OperationMetrics,
+  HealthStatus,
+  KeyPoolKind,
+  KeyPoolStats,
+  PrehashKind,
+  PrehashHandle,
+  PreparedKeyKind,
+  PreparedKeyHandle,
+  PreparedKeyStats,
+  PrivateKeyHandle,
+  PreparedVerifyItem,
+  ParameterSetInfo,
+  FalconVariant,
+  VerifyBatchItem,
+  VerifyBatchResult,
+  HybridVerifyItem,
 } from './types';
 import { performance } from 'perf_hooks';
 import bindings from 'bindings';
@@ -82,30 +110,26 @@ export class QuantumNative {
     }
   }
 
+  /**
+   * Reads the result of the native known-answer tests, which run on their
+   * own thread. Only runs them here if the native side has no result yet.
+   */
   public async performHealthCheck(): Promise<void> {
-    const start = performance.now();
     try {
-      const keyPair = await this.generateDilithiumKeyPair();
-      Logger.debug('Generated key pair for health check');
-      const testMessage = Buffer.from('health_check');
-      const signature = await this.dilithiumSign(
-        testMessage,
-        keyPair.privateKey,
-      );
-      const isValid = await this.dilithiumVerify(
-        testMessage,
-        signature,
-        keyPair.publicKey,
-      );
+      let status = this.native.getHealthStatus();
+      if (status.pending) {
+        status = await this.native.runHealthCheck();
+      }
 
-      if (!isValid) {
+      if (!status.healthy) {
         throw new QuantumError(
-          'Signature verification failed during health check',
+          `Known-answer tests failed (0x${status.failures.toString(16)})`,
         );
       }
 
-      const duration = performance.now() - start;
-      Logger.debug(`Quantum health check completed in ${duration}ms`);
+      Logger.debug(
+        `Quantum health check passed in ${status.lastDurationMicros}us`,
+      );
 
       // Reset failure counter on success
       this.healthCheckFailures = 0;
@@ -142,6 +166,7 @@ export class QuantumNative {
   // Core cryptographic operations with error handling and logging
   public async generateDilithiumKeyPair(
     entropy?: Buffer,
+    level?: SecurityLevel,
   ): Promise<QuantumKeyPair> {
     this.checkInitialization();
     const start = performance.now();
@@ -153,9 +178,7 @@ export class QuantumNative {
       }
 
       // Call native implementation with entropy if provided
-      const result = entropy
-        ? await this.native.generateDilithiumPair(entropy)
-        : await this.native.generateDilithiumPair();
+      const result = await this.native.generateDilithiumPair(entropy, level);
 
       // Validate response
       if (
@@ -185,12 +208,14 @@ export class QuantumNative {
     }
   }
 
-  public async kyberGenerateKeyPair(): Promise<QuantumKeyPair> {
+  public async kyberGenerateKeyPair(
+    level?: SecurityLevel,
+  ): Promise<QuantumKeyPair> {
     this.checkInitialization();
     const start = performance.now();
 
     try {
-      const result = await this.native.kyberGenerateKeyPair();
+      const result = await this.native.kyberGenerateKeyPair(level);
       if (!result?.publicKey || !result?.privateKey) {
         throw new QuantumError('Invalid Kyber key pair generated');
       }
@@ -210,10 +235,188 @@ export class QuantumNative {
   public async dilithiumSign(
     message: Buffer,
     privateKey: Buffer,
+    level?: SecurityLevel,
+  ): Promise<Buffer> {
+    this.checkInitialization();
+    try {
+      return await this.native.dilithiumSign(message, privateKey, level);
+    } catch (error) {
+      Logger.error('Signing failed:', error);
+      throw new QuantumError(
+        error instanceof Error ? error.message : 'Signing failed',
+      );
+    }
+  }
+  /**
+   * Generate `count` key pairs in one native call, spread over the worker
+   * pool. Keys are packed back to back; use batchKeyPair() to slice one out.
+   */
+  public async generateKeyPairsBatch(
+    algorithm: KeyPairAlgorithm,
+    count: number,
+    level?: SecurityLevel,
+  ): Promise<KeyPairBatch> {
+    this.checkInitialization();
+    const start = performance.now();
+
+    try {
+      const batch = await this.native.generateKeyPairsBatch(
+        algorithm,
+        count,
+        level,
+      );
+      Logger.debug(
+        `${count} ${algorithm} key pairs generated in ${performance.now() - start}ms`,
+      );
+      return batch;
+    } catch (error) {
+      Logger.error('Batch key generation failed:', error);
+      throw new QuantumError(
+        error instanceof Error ? error.message : 'Batch key generation failed',
+      );
+    }
+  }
+
+  public batchKeyPair(batch: KeyPairBatch, index: number): QuantumKeyPair {
+    if (!Number.isInteger(index) || index < 0 || index >= batch.count) {
+      throw new QuantumError('Key pair index out of range');
+    }
+    return {
+      publicKey: batch.publicKeys.subarray(
+        index * batch.publicKeyLength,
+        (index + 1) * batch.publicKeyLength,
+      ),
+      privateKey: batch.privateKeys.subarray(
+        index * batch.privateKeyLength,
+        (index + 1) * batch.privateKeyLength,
+      ),
+    };
+  }
+
+
+  /**
+   * Loads a Dilithium private key into native secure memory and returns an
+   * opaque handle. Signing by handle avoids marshalling the key on every
+   * call; callers should wipe their own copy once it is loaded. The key is
+   * unloaded when the handle is collected or passed to unloadPrivateKey.
+   */
+  public loadPrivateKey(
+    privateKey: Buffer,
+    level?: SecurityLevel,
+  ): PrivateKeyHandle {
+    this.checkInitialization();
+    try {
+      return this.native.loadPrivateKey(privateKey, level);
+    } catch (error) {
+      Logger.error('Failed to load private key:', error);
+      throw new QuantumError(
+        error instanceof Error ? error.message : 'Failed to load private key',
+      );
+    }
+  }
+
+  public async signWithHandle(
+    handle: PrivateKeyHandle,
+    message: Buffer,
+  ): Promise<Buffer> {
+    this.checkInitialization();
+    try {
+      return await this.native.signWithHandle(handle, message);
+    } catch (error) {
+      Logger.error('Signing failed:', error);
+      throw new QuantumError(
+        error instanceof Error ? error.message : 'Signing failed',
+      );
+    }
+  }
+
+  public unloadPrivateKey(handle: PrivateKeyHandle): boolean {
+    this.checkInitialization();
+    return this.native.unloadPrivateKey(handle);
+  }
+
+  /**
+   * Loads a Kyber private key for decapsulation by handle. The key is
+   * checked once here and shared by every later call; release it with
+   * unloadPrivateKey.
+   */
+  public loadKyberPrivateKey(
+    privateKey: Buffer,
+    level?: SecurityLevel,
+  ): PrivateKeyHandle {
+    this.checkInitialization();
+    try {
+      return this.native.loadKyberPrivateKey(privateKey, level);
+    } catch (error) {
+      Logger.error('Failed to load Kyber private key:', error);
+      throw new QuantumError(
+        error instanceof Error
+          ? error.message
+          : 'Failed to load Kyber private key',
+      );
+    }
+  }
+
+  public async kyberDecapsulateWithHandle(
+    handle: PrivateKeyHandle,
+    ciphertext: Buffer,
+  ): Promise<Buffer> {
+    this.checkInitialization();
+    try {
+      return await this.native.kyberDecapsulateWithHandle(handle, ciphertext);
+    } catch (error) {
+      Logger.error('Decapsulation failed:', error);
+      throw new QuantumError(
+        error instanceof Error ? error.message : 'Decapsulation failed',
+      );
+    }
+  }
+
+  public async kyberDecapsulateBatchWithHandle(
+    handle: PrivateKeyHandle,
+    ciphertexts: Buffer[],
+  ): Promise<Buffer> {
+    this.checkInitialization();
+    try {
+      return await this.native.kyberDecapsulateBatchWithHandle(
+        handle,
+        ciphertexts,
+      );
+    } catch (error) {
+      Logger.error('Batch decapsulation failed:', error);
+      throw new QuantumError(
+        error instanceof Error ? error.message : 'Batch decapsulation failed',
+      );
+    }
+  }
+
+  /**
+   * Starts a streaming signature or verification. Feed the message with
+   * prehashUpdate as it is serialized or read, then finish with prehashSign
+   * or prehashVerify; memory use does not grow with the message. Signatures
+   * made this way only verify through prehashVerify with the same kind,
+   * parameter set and context.
+   */
+  public prehashInit(
+    kind: PrehashKind,
+    levelOrVariant?: SecurityLevel | FalconVariant,
+    context?: Buffer,
+  ): PrehashHandle {
+    this.checkInitialization();
+    return this.native.prehashInit(kind, levelOrVariant, context);
+  }
+
+  public prehashUpdate(handle: PrehashHandle, data: Buffer): void {
+    this.native.prehashUpdate(handle, data);
+  }
+
+  public async prehashSign(
+    handle: PrehashHandle,
+    privateKey: Buffer,
   ): Promise<Buffer> {
     this.checkInitialization();
     try {
-      return await this.native.dilithiumSign(message, privateKey);
+      return await this.native.prehashSign(handle, privateKey);
     } catch (error) {
       Logger.error('Signing failed:', error);
       throw new QuantumError(
@@ -222,14 +425,36 @@ export class QuantumNative {
     }
   }
 
+  public async prehashVerify(
+    handle: PrehashHandle,
+    signature: Buffer,
+    publicKey: Buffer,
+  ): Promise<boolean> {
+    this.checkInitialization();
+    try {
+      return await this.native.prehashVerify(handle, signature, publicKey);
+    } catch (error) {
+      Logger.error('Verification failed:', error);
+      throw new QuantumError(
+        error instanceof Error ? error.message : 'Verification failed',
+      );
+    }
+  }
+
   public async dilithiumVerify(
     message: Buffer,
     signature: Buffer,
     publicKey: Buffer,
+    level?: SecurityLevel,
   ): Promise<boolean> {
     this.checkInitialization();
     try {
-      return await this.native.dilithiumVerify(message, signature, publicKey);
+      return await this.native.dilithiumVerify(
+        message,
+        signature,
+        publicKey,
+        level,
+      );
     } catch (error) {
       Logger.error('Verification failed:', error);
       throw new QuantumError(
@@ -238,12 +463,157 @@ export class QuantumNative {
     }
   }
 
+  /**
+   * Verifies many signatures in a single native call on the addon's worker
+   * pool. With earlyAbort set, verification stops at the first failure.
+   */
+  public async dilithiumVerifyBatch(
+    items: VerifyBatchItem[],
+    earlyAbort = false,
+    level?: SecurityLevel,
+  ): Promise<VerifyBatchResult> {
+    this.checkInitialization();
+    try {
+      return await this.native.dilithiumVerifyBatch(items, earlyAbort, level);
+    } catch (error) {
+      Logger.error('Batch verification failed:', error);
+      throw new QuantumError(
+        error instanceof Error ? error.message : 'Batch verification failed',
+      );
+    }
+  }
+
+  /**
+   * Verifies a hybrid signature in one native call: secp256k1 ECDSA (via
+   * OpenSSL) over SHA-256(message) and Dilithium over the message run
+   * concurrently on the worker pool. True only when both halves verify.
+   */
+  public async verifyHybrid(
+    message: Buffer,
+    ecdsaSignature: Buffer,
+    ecdsaPublicKey: Buffer,
+    signature: Buffer,
+    publicKey: Buffer,
+    level?: SecurityLevel,
+  ): Promise<boolean> {
+    this.checkInitialization();
+    try {
+      return await this.native.verifyHybrid(
+        message,
+        ecdsaSignature,
+        ecdsaPublicKey,
+        signature,
+        publicKey,
+        level,
+      );
+    } catch (error) {
+      Logger.error('Hybrid verification failed:', error);
+      throw new QuantumError(
+        error instanceof Error ? error.message : 'Hybrid verification failed',
+      );
+    }
+  }
+
+  public async verifyHybridBatch(
+    items: HybridVerifyItem[],
+    earlyAbort = false,
+    level?: SecurityLevel,
+  ): Promise<VerifyBatchResult> {
+    this.checkInitialization();
+    try {
+      return await this.native.verifyHybridBatch(items, earlyAbort, level);
+    } catch (error) {
+      Logger.error('Hybrid batch verification failed:', error);
+      throw new QuantumError(
+        error instanceof Error
+          ? error.message
+          : 'Hybrid batch verification failed',
+      );
+    }
+  }
+
+  /**
+   * Falcon signatures: roughly 700 bytes at Falcon-512 instead of 4.6 KB
+   * for Dilithium5, with faster verification. Signatures are variable
+   * length; the variant defaults to 512.
+   */
+  public async generateFalconKeyPair(
+    variant?: FalconVariant,
+  ): Promise<QuantumKeyPair> {
+    this.checkInitialization();
+    try {
+      return await this.native.generateFalconKeyPair(variant);
+    } catch (error) {
+      Logger.error('Failed to generate Falcon key pair:', error);
+      throw new QuantumError(
+        error instanceof Error ? error.message : 'Falcon key generation failed',
+      );
+    }
+  }
+
+  public async falconSign(
+    message: Buffer,
+    privateKey: Buffer,
+    variant?: FalconVariant,
+  ): Promise<Buffer> {
+    this.checkInitialization();
+    try {
+      return await this.native.falconSign(message, privateKey, variant);
+    } catch (error) {
+      Logger.error('Falcon signing failed:', error);
+      throw new QuantumError(
+        error instanceof Error ? error.message : 'Falcon signing failed',
+      );
+    }
+  }
+
+  public async falconVerify(
+    message: Buffer,
+    signature: Buffer,
+    publicKey: Buffer,
+    variant?: FalconVariant,
+  ): Promise<boolean> {
+    this.checkInitialization();
+    try {
+      return await this.native.falconVerify(
+        message,
+        signature,
+        publicKey,
+        variant,
+      );
+    } catch (error) {
+      Logger.error('Falcon verification failed:', error);
+      throw new QuantumError(
+        error instanceof Error ? error.message : 'Falcon verification failed',
+      );
+    }
+  }
+
+  public async falconVerifyBatch(
+    items: VerifyBatchItem[],
+    earlyAbort = false,
+    variant?: FalconVariant,
+  ): Promise<VerifyBatchResult> {
+    this.checkInitialization();
+    try {
+      return await this.native.falconVerifyBatch(items, earlyAbort, variant);
+    } catch (error) {
+      Logger.error('Falcon batch verification failed:', error);
+      throw new QuantumError(
+        error instanceof Error
+          ? error.message
+          : 'Falcon batch verification failed',
+      );
+    }
+  }
+
   public async kyberEncapsulate(
     publicKey: Buffer,
+    level?: SecurityLevel,
   ): Promise<KyberEncapsulation> {
     this.checkInitialization();
     try {
-      const result = await this.native.kyberEncapsulate(publicKey);
+      const result = await this.native.kyberEncapsulate(publicKey, level);
       if (!result?.ciphertext || !result?.sharedSecret) {
         throw new QuantumError('Invalid encapsulation result');
       }
@@ -259,10 +629,11 @@ export class QuantumNative {
   public async kyberDecapsulate(
     ciphertext: Buffer,
     privateKey: Buffer,
+    level?: SecurityLevel,
   ): Promise<Buffer> {
     this.checkInitialization();
     try {
-      return await this.native.kyberDecapsulate(ciphertext, privateKey);
+      return await this.native.kyberDecapsulate(ciphertext, privateKey, level);
     } catch (error) {
       Logger.error('Decapsulation failed:', error);
       throw new QuantumError(
@@ -271,6 +642,69 @@ export class QuantumNative {
     }
   }
 
+  /**
+   * Encapsulates to many peers in one native call, spread over the worker
+   * pool. Results are packed back to back; use batchEncapsulation() to
+   * slice one out.
+   */
+  public async kyberEncapsulateBatch(
+    publicKeys: Buffer[],
+    level?: SecurityLevel,
+  ): Promise<KyberEncapsulationBatch> {
+    this.checkInitialization();
+    try {
+      return await this.native.kyberEncapsulateBatch(publicKeys, level);
+    } catch (error) {
+      Logger.error('Batch encapsulation failed:', error);
+      throw new QuantumError(
+        error instanceof Error ? error.message : 'Batch encapsulation failed',
+      );
+    }
+  }
+
+  public batchEncapsulation(
+    batch: KyberEncapsulationBatch,
+    index: number,
+  ): KyberEncapsulation {
+    if (!Number.isInteger(index) || index < 0 || index >= batch.count) {
+      throw new QuantumError('Encapsulation index out of range');
+    }
+    return {
+      ciphertext: batch.ciphertexts.subarray(
+        index * batch.ciphertextLength,
+        (index + 1) * batch.ciphertextLength,
+      ),
+      sharedSecret: batch.sharedSecrets.subarray(
+        index * batch.sharedSecretLength,
+        (index + 1) * batch.sharedSecretLength,
+      ),
+    };
+  }
+
+  /**
+   * Decapsulates many ciphertexts under one private key. Resolves to the
+   * shared secrets back to back, in input order.
+   */
+  public async kyberDecapsulateBatch(
+    ciphertexts: Buffer[],
+    privateKey: Buffer,
+    level?: SecurityLevel,
+  ): Promise<Buffer> {
+    this.checkInitialization();
+    try {
+      return await this.native.kyberDecapsulateBatch(
+        ciphertexts,
+        privateKey,
+        level,
+      );
+    } catch (error) {
+      Logger.error('Batch decapsulation failed:', error);
+      throw new QuantumError(
+        error instanceof Error ? error.message : 'Batch decapsulation failed',
+      );
+    }
+  }
+
   public async dilithiumHash(data: Buffer): Promise<Buffer> {
     this.checkInitialization();
     try {
@@ -295,6 +729,318 @@ export class QuantumNative {
     }
   }
 
+  /**
+   * Keyless deterministic 64-byte hybrid hash (SHA3-512 + SHAKE256 with
+   * domain separation). Runs synchronously; it is cheap enough that a
+   * worker round trip would cost more than the hash.
+   */
+  public hybridHash(data: Buffer): Buffer {
+    this.checkInitialization();
+    return this.native.hybridHash(data);
+  }
+
+  /**
+   * Hybrid-hashes every item and returns one 64-byte digest per input.
+   */
+  public hybridHashBatch(items: Buffer[]): Buffer[] {
+    this.checkInitialization();
+    const digests = this.native.hybridHashBatch(items);
+    const result: Buffer[] = [];
+    for (let i = 0; i < items.length; i++) {
+      result.push(digests.subarray(i * 64, (i + 1) * 64));
+    }
+    return result;
+  }
+
+  /**
+   * Resizes the native worker pool that runs every async operation.
+   * Defaults to half the cores, or H3TAG_CRYPTO_THREADS if set; the rest
+   * go to the pool that batch operations fan out onto.
+   */
+  public setWorkerThreads(threads: number): void {
+    this.checkInitialization();
+    this.native.setWorkerThreads(threads);
+  }
+
+  /**
+   * Hashes many independent messages in one native call and returns one
+   * digest per input. SHA3/SHAKE batches use the multi-buffer SIMD engine
+   * when the CPU supports it.
+   */
+  public async hashBatch(
+    algorithm: HashAlgorithm,
+    items: Buffer[],
+    outputLength?: number,
+  ): Promise<Buffer[]> {
+    this.checkInitialization();
+    try {
+      const digests = await this.native.hashBatch(
+        algorithm,
+        items,
+        outputLength,
+      );
+      const size = digests.length / Math.max(items.length, 1);
+      const result: Buffer[] = [];
+      for (let i = 0; i < items.length; i++) {
+        result.push(digests.subarray(i * size, (i + 1) * size));
+      }
+      return result;
+    } catch (error) {
+      Logger.error('Batch hashing failed:', error);
+      throw new QuantumError(
+        error instanceof Error ? error.message : 'Batch hashing failed',
+      );
+    }
+  }
+
+  /**
+   * Builds a SHA3-256 Merkle tree natively, hashing each layer in parallel
+   * SIMD batches. Leaves are raw items unless prehashed is set, in which
+   * case they must already be 32-byte leaf hashes.
+   */
+  public async merkleBuild(
+    leaves: Buffer[],
+    prehashed = false,
+  ): Promise<NativeMerkleTree> {
+    this.checkInitialization();
+    try {
+      return await this.native.merkleBuild(leaves, prehashed);
+    } catch (error) {
+      Logger.error('Merkle tree build failed:', error);
+      throw new QuantumError(
+        error instanceof Error ? error.message : 'Merkle tree build failed',
+      );
+    }
+  }
+
+  /**
+   * Reads the inclusion proof for one leaf out of a tree from merkleBuild.
+   */
+  public merkleProof(tree: NativeMerkleTree, index: number): NativeMerkleProof {
+    this.checkInitialization();
+    return this.native.merkleProof(tree.nodes, tree.leafCount, index);
+  }
+
+  /**
+   * Verifies many inclusion proofs against one root in a single native call.
+   */
+  public async merkleVerifyProofs(
+    root: Buffer,
+    proofs: NativeMerkleProof[],
+  ): Promise<boolean[]> {
+    this.checkInitialization();
+    try {
+      return await this.native.merkleVerifyProofs(root, proofs);
+    } catch (error) {
+      Logger.error('Merkle proof verification failed:', error);
+      throw new QuantumError(
+        error instanceof Error
+          ? error.message
+          : 'Merkle proof verification failed',
+      );
+    }
+  }
+
+  /**
+   * Native proof-of-work search over SHA3-256(headerBase || nonce). The
+   * header is absorbed once and nonces are hashed in SIMD lanes across
+   * native threads; only the winning nonce and hash come back.
+   */
+  public async mine(options: NativeMiningOptions): Promise<NativeMiningResult> {
+    this.checkInitialization();
+    try {
+      return await this.native.mine(options);
+    } catch (error) {
+      Logger.error('Native mining failed:', error);
+      throw new QuantumError(
+        error instanceof Error ? error.message : 'Native mining failed',
+      );
+    }
+  }
+
+  public cancelMining(): void {
+    this.native.cancelMining();
+  }
+
+  /**
+   * Current mining generation. Passing it as `generation` to mine() makes
+   * the call resolve as cancelled once cancelMining() has run since, so a
+   * search split into slices stops even if the cancel lands between them.
+   */
+  public getMiningGeneration(): number {
+    return this.native.getMiningGeneration();
+  }
+
+  /**
+   * Usage of the native secure heap that holds private keys and shared
+   * secrets. A non-zero fallback count means the heap is undersized.
+   */
+  public getSecureMemoryStats(): SecureMemoryStats {
+    this.checkInitialization();
+    return this.native.getSecureMemoryStats();
+  }
+
+  /**
+   * Random bytes from the calling thread's native CTR-DRBG, seeded from the
+   * OS and re-seeded after fork(). Used for keys, salts, IVs and nonces.
+   */
+  public randomBytes(length: number): Buffer {
+    this.checkInitialization();
+    return this.native.randomBytes(length);
+  }
+
+  public getEntropyStats(): EntropyStats {
+    this.checkInitialization();
+    return this.native.getEntropyStats();
+  }
+
+  public getSecurityLogStats(): SecurityLogStats {
+    this.checkInitialization();
+    return this.native.getSecurityLogStats();
+  }
+
+  public getHealthStatus(): HealthStatus {
+    this.checkInitialization();
+    return this.native.getHealthStatus();
+  }
+
+  /**
+   * Runs the native known-answer tests now, on a worker thread.
+   */
+  public async runHealthCheck(): Promise<HealthStatus> {
+    this.checkInitialization();
+    return this.native.runHealthCheck();
+  }
+
+  /**
+   * Per-operation latency histograms kept by the native layer. Cheap to call
+   * on every scrape; recording threads are never paused.
+   */
+  public getOperationMetrics(): OperationMetrics[] {
+    this.checkInitialization();
+    return this.native.getOperationMetrics();
+  }
+
+  /**
+   * Counters of the native signature verification cache. Repeated
+   * verifications of the same (message, signature, key) are served from it.
+   */
+  public getVerifyCacheStats(): VerifyCacheStats {
+    this.checkInitialization();
+    return this.native.getVerifyCacheStats();
+  }
+
+  public clearVerifyCache(): void {
+    this.checkInitialization();
+    this.native.clearVerifyCache();
+  }
+
+  /**
+   * Validates a signer's public key once and returns a handle for
+   * verifyPrepared and verifyPreparedBatch, which skip re-checking and
+   * re-digesting the key on every call. Preparing the same key again is
+   * served from a native cache.
+   */
+  public preparePublicKey(
+    kind: PreparedKeyKind,
+    publicKey: Buffer,
+    levelOrVariant?: SecurityLevel | FalconVariant,
+  ): PreparedKeyHandle {
+    this.checkInitialization();
+    try {
+      return this.native.preparePublicKey(kind, publicKey, levelOrVariant);
+    } catch (error) {
+      Logger.error('Failed to prepare public key:', error);
+      throw new QuantumError(
+        error instanceof Error
+          ? error.message
+          : 'Public key preparation failed',
+      );
+    }
+  }
+
+  public async verifyPrepared(
+    handle: PreparedKeyHandle,
+    message: Buffer,
+    signature: Buffer,
+  ): Promise<boolean> {
+    this.checkInitialization();
+    try {
+      return await this.native.verifyPrepared(handle, message, signature);
+    } catch (error) {
+      Logger.error('Verification failed:', error);
+      throw new QuantumError(
+        error instanceof Error ? error.message : 'Verification failed',
+      );
+    }
+  }
+
+  /**
+   * Verifies many messages from one signer in a single native call. With
+   * earlyAbort set, verification stops at the first failure.
+   */
+  public async verifyPreparedBatch(
+    handle: PreparedKeyHandle,
+    items: PreparedVerifyItem[],
+    earlyAbort = false,
+  ): Promise<VerifyBatchResult> {
+    this.checkInitialization();
+    try {
+      return await this.native.verifyPreparedBatch(handle, items, earlyAbort);
+    } catch (error) {
+      Logger.error('Batch verification failed:', error);
+      throw new QuantumError(
+        error instanceof Error ? error.message : 'Batch verification failed',
+      );
+    }
+  }
+
+  public getPreparedKeyStats(): PreparedKeyStats {
+    this.checkInitialization();
+    return this.native.getPreparedKeyStats();
+  }
+
+  /**
+   * Keep up to `depth` key pairs pre-generated in the background for one
+   * algorithm; key generation then returns a ready pair. Depth 0 stops the
+   * pool. The level (or Falcon variant) defaults like the keygen calls do.
+   */
+  public setKeyPoolDepth(
+    kind: KeyPoolKind,
+    depth: number,
+    levelOrVariant?: SecurityLevel | FalconVariant,
+  ): void {
+    this.checkInitialization();
+    try {
+      this.native.setKeyPoolDepth(kind, depth, levelOrVariant);
+    } catch (error) {
+      Logger.error('Failed to configure key pool:', error);
+      throw new QuantumError(
+        error instanceof Error ? error.message : 'Failed to configure key pool',
+      );
+    }
+  }
+
+  public getKeyPoolStats(): KeyPoolStats[] {
+    this.checkInitialization();
+    return this.native.getKeyPoolStats();
+  }
+
+  /**
+   * Parameter set used when a call does not name one. Every level keeps its
+   * own native contexts, so switching does not affect calls that pass an
+   * explicit level.
+   */
+  public getSecurityLevel(): SecurityLevel {
+    this.checkInitialization();
+    return this.native.getSecurityLevel();
+  }
+
+  public getParameterSet(level?: SecurityLevel): ParameterSetInfo {
+    this.checkInitialization();
+    return this.native.getParameterSet(level);
+  }
+
   public async setSecurityLevel(level: SecurityLevel): Promise<void> {
     this.checkInitialization();
     try {
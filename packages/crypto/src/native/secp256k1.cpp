@@ -0,0 +1,100 @@
+#include "secp256k1.h"
+#include <openssl/core_names.h>
+#include <openssl/ec.h>
+#include <openssl/evp.h>
+#include <openssl/obj_mac.h>
+#include <openssl/params.h>
+#include <openssl/sha.h>
+#include <memory>
+#include <mutex>
+
+namespace quantum
+{
+
+    namespace
+    {
+        using PkeyPtr = std::unique_ptr<EVP_PKEY, decltype(&EVP_PKEY_free)>;
+        using PkeyCtxPtr = std::unique_ptr<EVP_PKEY_CTX, decltype(&EVP_PKEY_CTX_free)>;
+
+        constexpr size_t COMPRESSED_POINT = 33;
+        constexpr size_t UNCOMPRESSED_POINT = 65;
+
+        // Fetching the EC key manager is the slow part of importing a key,
+        // so each thread keeps one import context
+        EVP_PKEY_CTX *importContext()
+        {
+            thread_local PkeyCtxPtr context(EVP_PKEY_CTX_new_from_name(nullptr, "EC", nullptr), EVP_PKEY_CTX_free);
+            return context.get();
+        }
+
+        // Decodes and range-checks the point; off-curve points are rejected
+        PkeyPtr importPublicKey(ByteSpan publicKey)
+        {
+            PkeyPtr key(nullptr, EVP_PKEY_free);
+            if (publicKey.size() != COMPRESSED_POINT && publicKey.size() != UNCOMPRESSED_POINT)
+            {
+                return key;
+            }
+            EVP_PKEY_CTX *context = importContext();
+            if (!context || EVP_PKEY_fromdata_init(context) != 1)
+            {
+                return key;
+            }
+
+            char group[] = SN_secp256k1;
+            OSSL_PARAM params[] = {
+                OSSL_PARAM_construct_utf8_string(OSSL_PKEY_PARAM_GROUP_NAME, group, 0),
+                OSSL_PARAM_construct_octet_string(OSSL_PKEY_PARAM_PUB_KEY,
+                                                  const_cast<uint8_t *>(publicKey.data()), publicKey.size()),
+                OSSL_PARAM_construct_end()};
+
+            EVP_PKEY *imported = nullptr;
+            if (EVP_PKEY_fromdata(context, &imported, EVP_PKEY_PUBLIC_KEY, params) == 1)
+            {
+                key.reset(imported);
+            }
+            return key;
+        }
+    }
+
+    bool Secp256k1::available()
+    {
+        static const bool supported = []()
+        {
+            EC_GROUP *group = EC_GROUP_new_by_curve_name(NID_secp256k1);
+            EC_GROUP_free(group);
+            return group != nullptr;
+        }();
+        return supported;
+    }
+
+    bool Secp256k1::verifyDigest(ByteSpan digest, ByteSpan signature, ByteSpan publicKey)
+    {
+        if (digest.size() != DIGEST_SIZE || signature.empty())
+        {
+            return false;
+        }
+        PkeyPtr key = importPublicKey(publicKey);
+        if (!key)
+        {
+            return false;
+        }
+        PkeyCtxPtr context(EVP_PKEY_CTX_new_from_pkey(nullptr, key.get(), nullptr), EVP_PKEY_CTX_free);
+        if (!context || EVP_PKEY_verify_init(context.get()) != 1)
+        {
+            return false;
+        }
+        // 1 is a valid signature; 0 and negative values cover both a wrong
+        // signature and one that is not valid DER
+        return EVP_PKEY_verify(context.get(), signature.data(), signature.size(),
+                               digest.data(), digest.size()) == 1;
+    }
+
+    bool Secp256k1::verify(ByteSpan message, ByteSpan signature, ByteSpan publicKey)
+    {
+        uint8_t digest[DIGEST_SIZE];
+        SHA256(message.data(), message.size(), digest);
+        return verifyDigest(ByteSpan(digest, sizeof(digest)), signature, publicKey);
+    }
+
+} // namespace quantum
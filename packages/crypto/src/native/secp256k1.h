@@ -0,0 +1,31 @@
+#ifndef SECP256K1_H
+#define SECP256K1_H
+
+#include <cstddef>
+#include <cstdint>
+#include "memory.h"
+
+namespace quantum
+{
+
+    // secp256k1 ECDSA verification through OpenSSL, for the classical half
+    // of hybrid signatures. Stateless and safe to call from any thread.
+    class Secp256k1
+    {
+    public:
+        static constexpr size_t DIGEST_SIZE = 32;
+
+        // False when the linked OpenSSL was built without the curve
+        static bool available();
+
+        // publicKey is a SEC1 point (33 bytes compressed, 65 uncompressed)
+        // and signature is DER-encoded. Malformed input verifies as false.
+        static bool verifyDigest(ByteSpan digest, ByteSpan signature, ByteSpan publicKey);
+
+        // Verifies over SHA-256(message), the digest HybridCrypto signs
+        static bool verify(ByteSpan message, ByteSpan signature, ByteSpan publicKey);
+    };
+
+} // namespace quantum
+
+#endif // SECP256K1_H
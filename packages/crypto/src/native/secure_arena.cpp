@@ -0,0 +1,229 @@
+#include "secure_arena.h"
+#include <openssl/crypto.h>
+#include <atomic>
+#include <mutex>
+
+namespace quantum
+{
+
+    namespace
+    {
+        constexpr size_t CLASS_COUNT = 10; // 32 .. 16384
+        // Upper bound on bytes parked per size class in one thread's cache
+        constexpr size_t CACHE_BYTES_PER_CLASS = 32768;
+        constexpr size_t MAX_BLOCKS_PER_CLASS = 64;
+        // Share of the secure heap all thread caches together may hold
+        constexpr size_t CACHE_HEAP_FRACTION = 8;
+
+        std::once_flag initOnce;
+        std::atomic<int> initResult{0};
+        std::atomic<size_t> heapSize{0};
+
+        std::atomic<size_t> bytesInUse{0};
+        std::atomic<size_t> highWater{0};
+        std::atomic<uint64_t> allocations{0};
+        std::atomic<uint64_t> cacheHits{0};
+        std::atomic<uint64_t> fallbacks{0};
+        std::atomic<size_t> cachedBytes{0};
+
+        size_t classIndex(size_t bytes)
+        {
+            size_t index = 0;
+            size_t size = SecureArena::MIN_CLASS_SIZE;
+            while (size < bytes)
+            {
+                size <<= 1;
+                ++index;
+            }
+            return index;
+        }
+
+        size_t classSize(size_t index)
+        {
+            return SecureArena::MIN_CLASS_SIZE << index;
+        }
+
+        size_t blocksPerClass(size_t index)
+        {
+            size_t blocks = CACHE_BYTES_PER_CLASS / classSize(index);
+            if (blocks == 0)
+            {
+                return 1;
+            }
+            return blocks < MAX_BLOCKS_PER_CLASS ? blocks : MAX_BLOCKS_PER_CLASS;
+        }
+
+        // A thread may only park as many blocks of a class as it has recently
+        // allocated (credits), so threads that mostly free, such as the JS
+        // thread running Buffer finalizers, hand blocks straight back
+        // instead of hoarding memory they will never draw from.
+        struct ThreadCache
+        {
+            void *blocks[CLASS_COUNT][MAX_BLOCKS_PER_CLASS];
+            size_t counts[CLASS_COUNT]{};
+            size_t credits[CLASS_COUNT]{};
+
+            ~ThreadCache();
+        };
+
+        // Trivially destructible flag so frees during thread teardown can
+        // tell that the cache is already gone.
+        thread_local bool cacheDestroyed = false;
+        thread_local ThreadCache cache;
+
+        ThreadCache::~ThreadCache()
+        {
+            for (size_t index = 0; index < CLASS_COUNT; ++index)
+            {
+                for (size_t i = 0; i < counts[index]; ++i)
+                {
+                    OPENSSL_secure_free(blocks[index][i]);
+                }
+                cachedBytes.fetch_sub(counts[index] * classSize(index), std::memory_order_relaxed);
+                counts[index] = 0;
+            }
+            cacheDestroyed = true;
+        }
+
+        // Reserve room for one more cached block under the global bound.
+        bool reserveCache(size_t bytes)
+        {
+            size_t limit = heapSize.load(std::memory_order_relaxed) / CACHE_HEAP_FRACTION;
+            size_t cached = cachedBytes.load(std::memory_order_relaxed);
+            do
+            {
+                if (cached + bytes > limit)
+                {
+                    return false;
+                }
+            } while (!cachedBytes.compare_exchange_weak(cached, cached + bytes, std::memory_order_relaxed));
+            return true;
+        }
+
+        // Once the secure heap is initialised OPENSSL_secure_malloc returns
+        // NULL when it is full instead of falling back, so take ordinary
+        // memory then. OPENSSL_secure_free releases either kind.
+        void *secureMalloc(size_t bytes)
+        {
+            void *ptr = OPENSSL_secure_malloc(bytes);
+            if (!ptr)
+            {
+                ptr = OPENSSL_malloc(bytes);
+            }
+            if (ptr && !CRYPTO_secure_allocated(ptr))
+            {
+                fallbacks.fetch_add(1, std::memory_order_relaxed);
+            }
+            return ptr;
+        }
+
+        void recordAllocation(size_t bytes)
+        {
+            allocations.fetch_add(1, std::memory_order_relaxed);
+            size_t inUse = bytesInUse.fetch_add(bytes, std::memory_order_relaxed) + bytes;
+            size_t peak = highWater.load(std::memory_order_relaxed);
+            while (inUse > peak && !highWater.compare_exchange_weak(peak, inUse, std::memory_order_relaxed))
+            {
+            }
+        }
+    }
+
+    bool SecureArena::initialize(size_t heapBytes)
+    {
+        std::call_once(initOnce, [heapBytes]()
+                       {
+            size_t size = MIN_CLASS_SIZE;
+            while (size < heapBytes)
+            {
+                size <<= 1;
+            }
+            // 1 = secure and locked, 2 = usable but mlock/madvise failed
+            int result = CRYPTO_secure_malloc_init(size, MIN_CLASS_SIZE);
+            initResult.store(result, std::memory_order_relaxed);
+            if (result != 0)
+            {
+                heapSize.store(size, std::memory_order_relaxed);
+            } });
+        return CRYPTO_secure_malloc_initialized() == 1;
+    }
+
+    void *SecureArena::allocate(size_t bytes)
+    {
+        if (bytes > MAX_CACHED_SIZE)
+        {
+            void *ptr = secureMalloc(bytes);
+            if (ptr)
+            {
+                recordAllocation(bytes);
+            }
+            return ptr;
+        }
+
+        size_t index = classIndex(bytes);
+        void *ptr = nullptr;
+        if (!cacheDestroyed && cache.credits[index] < blocksPerClass(index))
+        {
+            ++cache.credits[index];
+        }
+        if (!cacheDestroyed && cache.counts[index] > 0)
+        {
+            ptr = cache.blocks[index][--cache.counts[index]];
+            cachedBytes.fetch_sub(classSize(index), std::memory_order_relaxed);
+            cacheHits.fetch_add(1, std::memory_order_relaxed);
+        }
+        else
+        {
+            ptr = secureMalloc(classSize(index));
+        }
+        if (ptr)
+        {
+            recordAllocation(classSize(index));
+        }
+        return ptr;
+    }
+
+    void SecureArena::deallocate(void *ptr, size_t bytes)
+    {
+        if (!ptr)
+        {
+            return;
+        }
+        if (bytes > MAX_CACHED_SIZE)
+        {
+            bytesInUse.fetch_sub(bytes, std::memory_order_relaxed);
+            OPENSSL_secure_free(ptr);
+            return;
+        }
+
+        size_t index = classIndex(bytes);
+        bytesInUse.fetch_sub(classSize(index), std::memory_order_relaxed);
+        // Only secure-heap blocks are worth recycling; fallback blocks go
+        // straight back so they are not handed out as if they were locked.
+        if (!cacheDestroyed && cache.credits[index] > 0 && cache.counts[index] < blocksPerClass(index) &&
+            CRYPTO_secure_allocated(ptr) && reserveCache(classSize(index)))
+        {
+            --cache.credits[index];
+            cache.blocks[index][cache.counts[index]++] = ptr;
+            return;
+        }
+        OPENSSL_secure_free(ptr);
+    }
+
+    SecureArenaStats SecureArena::stats()
+    {
+        SecureArenaStats stats;
+        int result = initResult.load(std::memory_order_relaxed);
+        stats.initialized = CRYPTO_secure_malloc_initialized() == 1;
+        stats.locked = stats.initialized && result == 1;
+        stats.heapSize = heapSize.load(std::memory_order_relaxed);
+        stats.heapUsed = stats.initialized ? CRYPTO_secure_used() : 0;
+        stats.bytesInUse = bytesInUse.load(std::memory_order_relaxed);
+        stats.highWater = highWater.load(std::memory_order_relaxed);
+        stats.allocations = allocations.load(std::memory_order_relaxed);
+        stats.cacheHits = cacheHits.load(std::memory_order_relaxed);
+        stats.cachedBytes = cachedBytes.load(std::memory_order_relaxed);
+        stats.fallbacks = fallbacks.load(std::memory_order_relaxed);
+        return stats;
+    }
+
+} // namespace quantum
@@ -0,0 +1,53 @@
+#ifndef SECURE_ARENA_H
+#define SECURE_ARENA_H
+
+#include <cstddef>
+#include <cstdint>
+
+namespace quantum
+{
+
+    struct SecureArenaStats
+    {
+        bool initialized{false}; // OpenSSL secure heap is active
+        bool locked{false};      // heap pages are mlocked and excluded from core dumps
+        size_t heapSize{0};
+        size_t heapUsed{0};      // bytes the secure heap has handed out, caches included
+        size_t bytesInUse{0};    // bytes held by live secret buffers
+        size_t highWater{0};
+        uint64_t allocations{0};
+        uint64_t cacheHits{0};   // allocations served from a thread cache
+        size_t cachedBytes{0};   // bytes parked in thread caches, all threads
+        uint64_t fallbacks{0};   // allocations that landed outside the secure heap
+    };
+
+    // Allocator behind the secret SecureBuffers (private keys, shared
+    // secrets). Memory comes from the OpenSSL secure heap (mmap'd, mlocked,
+    // MADV_DONTDUMP) once initialize() has sized it. Before that, or once it
+    // is exhausted, allocations are served from the normal heap and counted
+    // as fallbacks rather than failing. Requests up to MAX_CACHED_SIZE are
+    // rounded to power-of-two size classes, matching the secure heap's buddy
+    // allocator, and freed blocks are kept in small per-thread caches so the
+    // fixed key and secret sizes recycle without touching the secure heap
+    // lock. A thread only caches what it has recently allocated, and all
+    // caches together hold at most an eighth of the heap. Blocks are zeroed
+    // by SecureBuffer before release.
+    class SecureArena
+    {
+    public:
+        static constexpr size_t MIN_CLASS_SIZE = 32;
+        static constexpr size_t MAX_CACHED_SIZE = 16384;
+
+        // Size the secure heap. heapBytes is rounded up to a power of two.
+        // Only the first call takes effect; returns whether the heap is active.
+        static bool initialize(size_t heapBytes);
+
+        static void *allocate(size_t bytes);
+        static void deallocate(void *ptr, size_t bytes);
+
+        static SecureArenaStats stats();
+    };
+
+} // namespace quantum
+
+#endif // SECURE_ARENA_H
@@ -2,11 +2,300 @@
 #include <mutex>
 #include <chrono>
 #include <atomic>
-#include <iostream>
-#include <sstream>
-#include <iomanip>
+#include <algorithm>
+#include <condition_variable>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
 #include <ctime>
-#include <fstream>
+#include <thread>
+#include <vector>
+#include <fcntl.h>
+#ifdef _WIN32
+#include <intrin.h>
+#include <io.h>
+#else
+#include <cerrno>
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
+namespace
+{
+    constexpr size_t RING_CAPACITY = 1024; // power of two
+    constexpr size_t OPERATION_BYTES = 64;
+    constexpr size_t ERROR_BYTES = 256;
+    // Identical messages logged more often than this per second are
+    // counted instead of queued
+    constexpr uint32_t RATE_LIMIT = 20;
+    constexpr size_t RATE_SLOTS = 1024;
+    constexpr auto FLUSH_INTERVAL = std::chrono::milliseconds(100);
+    constexpr auto REPORT_INTERVAL = std::chrono::seconds(1);
+    const char *const LOG_PATH = "security_errors.log";
+
+    struct Record
+    {
+        int64_t time; // system_clock seconds
+        uint64_t key;
+        size_t operationLength;
+        size_t errorLength;
+        char operation[OPERATION_BYTES];
+        char error[ERROR_BYTES];
+
+        bool sameMessage(const Record &other) const
+        {
+            return key == other.key && operationLength == other.operationLength &&
+                   errorLength == other.errorLength &&
+                   std::memcmp(operation, other.operation, operationLength) == 0 &&
+                   std::memcmp(error, other.error, errorLength) == 0;
+        }
+    };
+
+    struct Slot
+    {
+        std::atomic<size_t> sequence;
+        Record record;
+    };
+
+    // FNV-1a over both fields
+    uint64_t messageKey(const std::string &operation, const std::string &error)
+    {
+        uint64_t hash = 14695981039346656037ull;
+        auto mix = [&hash](const std::string &text)
+        {
+            for (unsigned char c : text)
+            {
+                hash = (hash ^ c) * 1099511628211ull;
+            }
+            hash = (hash ^ 0xff) * 1099511628211ull;
+        };
+        mix(operation);
+        mix(error);
+        return hash;
+    }
+
+    int openLog()
+    {
+#ifdef _WIN32
+        return _open(LOG_PATH, _O_WRONLY | _O_CREAT | _O_APPEND | _O_BINARY, _S_IREAD | _S_IWRITE);
+#else
+        return open(LOG_PATH, O_WRONLY | O_CREAT | O_APPEND | O_CLOEXEC, 0600);
+#endif
+    }
+
+    void writeAll(int fd, const char *data, size_t length)
+    {
+        while (length > 0)
+        {
+#ifdef _WIN32
+            int written = _write(fd, data, static_cast<unsigned int>(length));
+#else
+            ssize_t written = write(fd, data, length);
+            if (written < 0 && errno == EINTR)
+            {
+                continue;
+            }
+#endif
+            if (written <= 0)
+            {
+                return;
+            }
+            data += written;
+            length -= static_cast<size_t>(written);
+        }
+    }
+
+    void appendTimestamp(std::vector<char> &out, int64_t seconds)
+    {
+        std::time_t time = static_cast<std::time_t>(seconds);
+        // Use a thread-safe version of localtime
+        std::tm timeInfo;
+#ifdef _WIN32
+        localtime_s(&timeInfo, &time);
+#else
+        localtime_r(&time, &timeInfo);
+#endif
+        char text[32];
+        size_t length = std::strftime(text, sizeof(text), "[%Y-%m-%d %H:%M:%S] ", &timeInfo);
+        out.insert(out.end(), text, text + length);
+    }
+}
+
+namespace
+{
+    // Log-linear buckets in nanoseconds, HDR style: values below 8 get
+    // their own bucket, above that each power of two is split into 8.
+    constexpr size_t SUB_BUCKETS = 8;
+    constexpr size_t HISTOGRAM_BUCKETS = 62 * SUB_BUCKETS;
+    constexpr auto METRICS_WINDOW = std::chrono::seconds(60);
+    const char *const OPERATION_NAMES[MONITORED_OPERATION_COUNT] = {
+        "keygen", "sign", "verify", "encapsulate", "decapsulate", "queue_wait"};
+
+    size_t bucketIndex(uint64_t nanos)
+    {
+        if (nanos < SUB_BUCKETS)
+        {
+            return static_cast<size_t>(nanos);
+        }
+#ifdef _MSC_VER
+        unsigned long highest;
+        _BitScanReverse64(&highest, nanos);
+        unsigned exponent = static_cast<unsigned>(highest);
+#else
+        unsigned exponent = 63u - static_cast<unsigned>(__builtin_clzll(nanos));
+#endif
+        return (exponent - 2) * SUB_BUCKETS + ((nanos >> (exponent - 3)) & (SUB_BUCKETS - 1));
+    }
+
+    double bucketLower(size_t index)
+    {
+        if (index < SUB_BUCKETS)
+        {
+            return static_cast<double>(index);
+        }
+        unsigned exponent = static_cast<unsigned>(index / SUB_BUCKETS) + 2;
+        return std::ldexp(static_cast<double>(SUB_BUCKETS + index % SUB_BUCKETS), static_cast<int>(exponent) - 3);
+    }
+
+    double bucketMiddle(size_t index)
+    {
+        return (bucketLower(index) + bucketLower(index + 1)) / 2;
+    }
+
+    // One thread's histograms. Written only by that thread, with relaxed
+    // load/store pairs, so recording never contends.
+    struct ThreadHistograms
+    {
+        struct Operation
+        {
+            std::atomic<uint64_t> buckets[HISTOGRAM_BUCKETS];
+            std::atomic<uint64_t> failures;
+            std::atomic<uint64_t> totalNanos;
+        } operations[MONITORED_OPERATION_COUNT];
+    };
+
+    struct Totals
+    {
+        uint64_t buckets[MONITORED_OPERATION_COUNT][HISTOGRAM_BUCKETS];
+        uint64_t failures[MONITORED_OPERATION_COUNT];
+        uint64_t totalNanos[MONITORED_OPERATION_COUNT];
+    };
+
+    struct MetricsRegistry
+    {
+        std::mutex mutex;
+        std::vector<ThreadHistograms *> live;
+        Totals retired{};
+        // Cumulative totals at the last two window rotations; quantiles are
+        // taken over everything recorded since the older one
+        Totals older{};
+        Totals newer{};
+        std::chrono::steady_clock::time_point rotated{std::chrono::steady_clock::now()};
+    };
+
+    void installMetricsForkHandlers();
+
+    // Never destroyed: threads may exit after static destruction has begun
+    MetricsRegistry &metricsRegistry()
+    {
+        static MetricsRegistry *instance = []()
+        {
+            auto *created = new MetricsRegistry();
+            installMetricsForkHandlers();
+            return created;
+        }();
+        return *instance;
+    }
+
+    void addInto(Totals &totals, const ThreadHistograms &histograms)
+    {
+        for (size_t op = 0; op < MONITORED_OPERATION_COUNT; ++op)
+        {
+            const auto &source = histograms.operations[op];
+            for (size_t i = 0; i < HISTOGRAM_BUCKETS; ++i)
+            {
+                totals.buckets[op][i] += source.buckets[i].load(std::memory_order_relaxed);
+            }
+            totals.failures[op] += source.failures.load(std::memory_order_relaxed);
+            totals.totalNanos[op] += source.totalNanos.load(std::memory_order_relaxed);
+        }
+    }
+
+    struct ThreadHistogramsHandle
+    {
+        ThreadHistograms *histograms{nullptr};
+
+        ~ThreadHistogramsHandle()
+        {
+            if (histograms)
+            {
+                MetricsRegistry &registry = metricsRegistry();
+                std::lock_guard<std::mutex> lock(registry.mutex);
+                registry.live.erase(std::remove(registry.live.begin(), registry.live.end(), histograms),
+                                    registry.live.end());
+                addInto(registry.retired, *histograms);
+                delete histograms;
+            }
+        }
+
+        ThreadHistograms &get()
+        {
+            if (!histograms)
+            {
+                // Value-initialized: every counter starts at zero
+                auto *created = new ThreadHistograms();
+                MetricsRegistry &registry = metricsRegistry();
+                std::lock_guard<std::mutex> lock(registry.mutex);
+                registry.live.push_back(created);
+                histograms = created;
+            }
+            return *histograms;
+        }
+    };
+
+    thread_local ThreadHistogramsHandle threadHistograms;
+
+    void bump(std::atomic<uint64_t> &counter, uint64_t amount)
+    {
+        counter.store(counter.load(std::memory_order_relaxed) + amount, std::memory_order_relaxed);
+    }
+
+    double quantile(const uint64_t *window, uint64_t count, double q)
+    {
+        uint64_t rank = static_cast<uint64_t>(std::ceil(q * static_cast<double>(count)));
+        rank = std::max<uint64_t>(rank, 1);
+        uint64_t seen = 0;
+        for (size_t i = 0; i < HISTOGRAM_BUCKETS; ++i)
+        {
+            seen += window[i];
+            if (seen >= rank)
+            {
+                return bucketMiddle(i) / 1000.0;
+            }
+        }
+        return 0;
+    }
+
+#ifndef _WIN32
+    void metricsForkPrepare()
+    {
+        metricsRegistry().mutex.lock();
+    }
+
+    void metricsForkRelease()
+    {
+        metricsRegistry().mutex.unlock();
+    }
+#endif
+
+    void installMetricsForkHandlers()
+    {
+#ifndef _WIN32
+        // A fork during a snapshot must not leave the child's registry locked
+        pthread_atfork(metricsForkPrepare, metricsForkRelease, metricsForkRelease);
+#endif
+    }
+}
 
 struct SecurityMonitor::Implementation
 {
@@ -15,53 +304,361 @@ struct SecurityMonitor::Implementation
     std::atomic<bool> sideChannelDetected{false};
     std::chrono::steady_clock::time_point lastCheck;
 
-    Implementation() : lastCheck(std::chrono::steady_clock::now()) {}
+    // Bounded MPSC ring (Vyukov): producers claim a slot with one CAS and
+    // publish it through the slot's sequence number
+    std::unique_ptr<Slot[]> ring;
+    alignas(64) std::atomic<size_t> enqueuePos{0};
+    alignas(64) size_t dequeuePos{0}; // writer thread only
+    // Per-message budget, indexed by the low bits of the message key:
+    // (key tag << 40 | second << 16 | count). The tag is the key's top 24
+    // bits; a different message landing in the slot takes it over with a
+    // fresh count instead of inheriting, and being muted by, the budget of
+    // the one that flooded it.
+    std::atomic<uint64_t> rate[RATE_SLOTS];
+
+    std::atomic<uint64_t> queued{0};
+    std::atomic<uint64_t> written{0};
+    std::atomic<uint64_t> suppressed{0};
+    std::atomic<uint64_t> dropped{0};
+    uint64_t reportedSuppressed{0};
+    uint64_t reportedDropped{0};
+    std::chrono::steady_clock::time_point lastReport;
+
+    std::mutex wakeMutex;
+    std::condition_variable wake;
+    bool stopping{false};
+    int logFd;
+    std::thread writer;
+
+    Implementation()
+        : lastCheck(std::chrono::steady_clock::now()),
+          ring(new Slot[RING_CAPACITY])
+    {
+        for (size_t i = 0; i < RING_CAPACITY; ++i)
+        {
+            ring[i].sequence.store(i, std::memory_order_relaxed);
+        }
+        for (auto &slot : rate)
+        {
+            slot.store(0, std::memory_order_relaxed);
+        }
+        logFd = openLog();
+        writer = std::thread([this]()
+                             { run(); });
+    }
+
+    ~Implementation()
+    {
+        {
+            std::lock_guard<std::mutex> lock(wakeMutex);
+            stopping = true;
+        }
+        wake.notify_one();
+        writer.join();
+        if (logFd >= 0)
+        {
+#ifdef _WIN32
+            _close(logFd);
+#else
+            close(logFd);
+#endif
+        }
+    }
+
+    bool withinRate(uint64_t key, uint32_t second)
+    {
+        std::atomic<uint64_t> &slot = rate[key % RATE_SLOTS];
+        // Message tag and second; only compared for equality, so the
+        // second may wrap
+        uint64_t owner = (key >> 40) << 40 | static_cast<uint64_t>(second & 0xFFFFFF) << 16;
+        uint64_t current = slot.load(std::memory_order_relaxed);
+        for (;;)
+        {
+            uint64_t next;
+            if ((current & ~uint64_t(0xFFFF)) != owner)
+            {
+                next = owner | 1;
+            }
+            else if ((current & 0xFFFF) >= RATE_LIMIT)
+            {
+                return false;
+            }
+            else
+            {
+                next = current + 1;
+            }
+            if (slot.compare_exchange_weak(current, next, std::memory_order_relaxed))
+            {
+                return true;
+            }
+        }
+    }
+
+    void push(const std::string &operation, const std::string &error)
+    {
+        int64_t now = std::chrono::duration_cast<std::chrono::seconds>(
+                          std::chrono::system_clock::now().time_since_epoch())
+                          .count();
+        uint64_t key = messageKey(operation, error);
+        if (!withinRate(key, static_cast<uint32_t>(now)))
+        {
+            suppressed.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+
+        size_t pos = enqueuePos.load(std::memory_order_relaxed);
+        Slot *slot;
+        for (;;)
+        {
+            slot = &ring[pos & (RING_CAPACITY - 1)];
+            size_t sequence = slot->sequence.load(std::memory_order_acquire);
+            intptr_t diff = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(pos);
+            if (diff == 0)
+            {
+                if (enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                {
+                    break;
+                }
+            }
+            else if (diff < 0)
+            {
+                // Full: the writer is behind, drop rather than wait
+                dropped.fetch_add(1, std::memory_order_relaxed);
+                return;
+            }
+            else
+            {
+                pos = enqueuePos.load(std::memory_order_relaxed);
+            }
+        }
+
+        Record &record = slot->record;
+        record.time = now;
+        record.key = key;
+        record.operationLength = std::min(operation.size(), OPERATION_BYTES);
+        record.errorLength = std::min(error.size(), ERROR_BYTES);
+        std::memcpy(record.operation, operation.data(), record.operationLength);
+        std::memcpy(record.error, error.data(), record.errorLength);
+        slot->sequence.store(pos + 1, std::memory_order_release);
+        queued.fetch_add(1, std::memory_order_relaxed);
+        // Lost wakeups are bounded by FLUSH_INTERVAL
+        wake.notify_one();
+    }
+
+    bool pop(Record &record)
+    {
+        Slot &slot = ring[dequeuePos & (RING_CAPACITY - 1)];
+        if (slot.sequence.load(std::memory_order_acquire) != dequeuePos + 1)
+        {
+            return false;
+        }
+        record = slot.record;
+        slot.sequence.store(dequeuePos + RING_CAPACITY, std::memory_order_release);
+        ++dequeuePos;
+        return true;
+    }
+
+    bool pending() const
+    {
+        const Slot &slot = ring[dequeuePos & (RING_CAPACITY - 1)];
+        return slot.sequence.load(std::memory_order_acquire) == dequeuePos + 1;
+    }
+
+    void appendRecord(std::vector<char> &out, const Record &record, size_t repeats)
+    {
+        appendTimestamp(out, record.time);
+        const char prefix[] = "Security Failure - Operation: ";
+        const char separator[] = ", Error: ";
+        out.insert(out.end(), prefix, prefix + sizeof(prefix) - 1);
+        out.insert(out.end(), record.operation, record.operation + record.operationLength);
+        out.insert(out.end(), separator, separator + sizeof(separator) - 1);
+        out.insert(out.end(), record.error, record.error + record.errorLength);
+        if (repeats > 0)
+        {
+            char text[48];
+            int length = std::snprintf(text, sizeof(text), " (repeated %zu times)", repeats + 1);
+            out.insert(out.end(), text, text + length);
+        }
+        out.push_back('\n');
+        written.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    // Write everything queued so far as one batch; consecutive identical
+    // messages become a single line with a repeat count
+    void drain(std::vector<char> &out, bool final)
+    {
+        Record current;
+        Record next;
+        size_t repeats = 0;
+        bool haveCurrent = false;
+        while (pop(next))
+        {
+            if (haveCurrent && current.sameMessage(next))
+            {
+                ++repeats;
+                continue;
+            }
+            if (haveCurrent)
+            {
+                appendRecord(out, current, repeats);
+            }
+            current = next;
+            repeats = 0;
+            haveCurrent = true;
+        }
+        if (haveCurrent)
+        {
+            appendRecord(out, current, repeats);
+        }
+
+        uint64_t suppressedNow = suppressed.load(std::memory_order_relaxed);
+        uint64_t droppedNow = dropped.load(std::memory_order_relaxed);
+        auto reportTime = std::chrono::steady_clock::now();
+        if ((suppressedNow != reportedSuppressed || droppedNow != reportedDropped) &&
+            (final || reportTime - lastReport >= REPORT_INTERVAL))
+        {
+            int64_t now = std::chrono::duration_cast<std::chrono::seconds>(
+                              std::chrono::system_clock::now().time_since_epoch())
+                              .count();
+            appendTimestamp(out, now);
+            char text[128];
+            int length = std::snprintf(text, sizeof(text),
+                                       "Security Monitor - %llu messages rate-limited, %llu dropped\n",
+                                       static_cast<unsigned long long>(suppressedNow - reportedSuppressed),
+                                       static_cast<unsigned long long>(droppedNow - reportedDropped));
+            out.insert(out.end(), text, text + length);
+            reportedSuppressed = suppressedNow;
+            reportedDropped = droppedNow;
+            lastReport = reportTime;
+        }
+
+        if (!out.empty())
+        {
+            writeAll(2, out.data(), out.size());
+            if (logFd >= 0)
+            {
+                writeAll(logFd, out.data(), out.size());
+            }
+            out.clear();
+        }
+    }
+
+    void run()
+    {
+        std::vector<char> out;
+        out.reserve(64 * 1024);
+        for (;;)
+        {
+            bool stop;
+            {
+                std::unique_lock<std::mutex> lock(wakeMutex);
+                wake.wait_for(lock, FLUSH_INTERVAL, [this]()
+                              { return stopping || pending(); });
+                stop = stopping;
+            }
+            drain(out, stop);
+            if (stop)
+            {
+                return;
+            }
+        }
+    }
 };
 
 SecurityMonitor::SecurityMonitor()
     : pImpl(std::make_unique<Implementation>()) {}
 
+// Define the destructor here to ensure that Implementation is complete.
+// Joins the writer after it has flushed whatever is still queued.
+SecurityMonitor::~SecurityMonitor() = default;
+
 void SecurityMonitor::logFailure(const std::string &operation, const std::string &error)
 {
-    std::lock_guard<std::mutex> lock(pImpl->mutex);
-    // Get current timestamp
-    auto now = std::chrono::system_clock::now();
-    auto now_time_t = std::chrono::system_clock::to_time_t(now);
+    pImpl->push(operation, error);
+}
 
-    // Use a thread-safe version of localtime
-    std::tm timeInfo;
-#ifdef _WIN32
-    localtime_s(&timeInfo, &now_time_t);
-#else
-    localtime_r(&now_time_t, &timeInfo);
-#endif
+SecurityLogStats SecurityMonitor::logStats() const
+{
+    SecurityLogStats stats;
+    stats.queued = pImpl->queued.load(std::memory_order_relaxed);
+    stats.written = pImpl->written.load(std::memory_order_relaxed);
+    stats.suppressed = pImpl->suppressed.load(std::memory_order_relaxed);
+    stats.dropped = pImpl->dropped.load(std::memory_order_relaxed);
+    return stats;
+}
 
-    // Format the log message
-    std::stringstream logMessage;
-    logMessage << "[" << std::put_time(&timeInfo, "%Y-%m-%d %H:%M:%S") << "] "
-               << "Security Failure - Operation: " << operation
-               << ", Error: " << error << "\n";
+void SecurityMonitor::recordOperation(MonitoredOperation operation, uint64_t nanos, bool succeeded)
+{
+    auto &histogram = threadHistograms.get().operations[static_cast<size_t>(operation)];
+    bump(histogram.buckets[bucketIndex(nanos)], 1);
+    bump(histogram.totalNanos, nanos);
+    if (!succeeded)
+    {
+        bump(histogram.failures, 1);
+    }
+}
 
-    // Output to standard error (can be redirected to a file)
-    std::cerr << logMessage.str();
+std::vector<OperationMetrics> SecurityMonitor::operationMetrics()
+{
+    MetricsRegistry &registry = metricsRegistry();
+    auto totals = std::make_unique<Totals>();
+    std::vector<OperationMetrics> result;
 
-    // Write to a log file
-    std::ofstream logFile("security_errors.log", std::ios::app);
-    if (logFile.is_open())
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    *totals = registry.retired;
+    for (const ThreadHistograms *histograms : registry.live)
     {
-        logFile << logMessage.str();
+        addInto(*totals, *histograms);
     }
+
+    auto now = std::chrono::steady_clock::now();
+    if (now - registry.rotated >= METRICS_WINDOW)
+    {
+        registry.older = registry.newer;
+        registry.newer = *totals;
+        registry.rotated = now;
+    }
+
+    for (size_t op = 0; op < MONITORED_OPERATION_COUNT; ++op)
+    {
+        OperationMetrics metrics;
+        metrics.operation = OPERATION_NAMES[op];
+        metrics.failures = totals->failures[op];
+        metrics.totalMicros = static_cast<double>(totals->totalNanos[op]) / 1000.0;
+
+        uint64_t window[HISTOGRAM_BUCKETS];
+        for (size_t i = 0; i < HISTOGRAM_BUCKETS; ++i)
+        {
+            metrics.count += totals->buckets[op][i];
+            // Bucket counts only grow, so the difference is never negative
+            window[i] = totals->buckets[op][i] - registry.older.buckets[op][i];
+            metrics.windowCount += window[i];
+            if (window[i] != 0)
+            {
+                metrics.maxMicros = bucketMiddle(i) / 1000.0;
+            }
+        }
+        if (metrics.windowCount != 0)
+        {
+            metrics.p50Micros = quantile(window, metrics.windowCount, 0.5);
+            metrics.p90Micros = quantile(window, metrics.windowCount, 0.9);
+            metrics.p99Micros = quantile(window, metrics.windowCount, 0.99);
+            metrics.p999Micros = quantile(window, metrics.windowCount, 0.999);
+        }
+        result.push_back(metrics);
+    }
+    return result;
 }
 
+// Read on every crypto operation; the flags are atomics so the hot path
+// never contends on the logging mutex.
 bool SecurityMonitor::isSecurityLevelMaintained() const
 {
-    std::lock_guard<std::mutex> lock(pImpl->mutex);
     return pImpl->securityLevelMaintained.load();
 }
 
 bool SecurityMonitor::detectSideChannelVulnerability() const
 {
-    std::lock_guard<std::mutex> lock(pImpl->mutex);
     return pImpl->sideChannelDetected.load();
 }
 
@@ -71,4 +668,4 @@ void SecurityMonitor::initialize()
     pImpl->securityLevelMaintained = true;
     pImpl->sideChannelDetected = false;
     pImpl->lastCheck = std::chrono::steady_clock::now();
-}
\ No newline at end of file
+}
@@ -1,14 +1,54 @@
 #ifndef SECURITY_MONITOR_H
 #define SECURITY_MONITOR_H
 
+#include <chrono>
+#include <cstdint>
 #include <string>
 #include <memory>
+#include <vector>
+
+struct SecurityLogStats
+{
+    uint64_t queued{0};     // accepted into the ring
+    uint64_t written{0};    // lines written, repeats coalesced into one
+    uint64_t suppressed{0}; // over the per-message rate limit
+    uint64_t dropped{0};    // ring full
+};
+
+// Operations with latency histograms. QUEUE_WAIT is the time an async
+// call spends queued before a worker picks it up.
+enum class MonitoredOperation : uint32_t
+{
+    KEYGEN = 0,
+    SIGN = 1,
+    VERIFY = 2,
+    ENCAPSULATE = 3,
+    DECAPSULATE = 4,
+    QUEUE_WAIT = 5,
+};
+constexpr size_t MONITORED_OPERATION_COUNT = 6;
+
+struct OperationMetrics
+{
+    const char *operation;
+    uint64_t count{0};    // since process start
+    uint64_t failures{0}; // errors, and rejected signatures for VERIFY
+    double totalMicros{0};
+    // Quantiles over a sliding window of the last one to two minutes,
+    // accurate to within about 6%
+    uint64_t windowCount{0};
+    double p50Micros{0};
+    double p90Micros{0};
+    double p99Micros{0};
+    double p999Micros{0};
+    double maxMicros{0};
+};
 
 class SecurityMonitor
 {
 public:
     SecurityMonitor();
-    ~SecurityMonitor() = default;
+    ~SecurityMonitor();
 
     // Explicitly delete copy and move semantics
     SecurityMonitor(const SecurityMonitor &) = delete;
@@ -16,7 +56,19 @@ public:
     SecurityMonitor &operator=(const SecurityMonitor &) = delete;
     SecurityMonitor &operator=(SecurityMonitor &&) = delete;
 
+    // Never blocks on I/O: the message goes into a bounded lock-free ring
+    // and a background thread writes it to stderr and security_errors.log.
+    // Floods are rate-limited per message and dropped once the ring is
+    // full; both are counted and reported in the log.
     void logFailure(const std::string &operation, const std::string &error);
+    SecurityLogStats logStats() const;
+
+    // Latency histograms are process-wide and kept per thread: recording is
+    // a few uncontended relaxed stores, and operationMetrics() aggregates
+    // the threads without pausing them.
+    static void recordOperation(MonitoredOperation operation, uint64_t nanos, bool succeeded);
+    static std::vector<OperationMetrics> operationMetrics();
+
     bool isSecurityLevelMaintained() const;
     bool detectSideChannelVulnerability() const;
     void initialize();
@@ -26,4 +78,32 @@ private:
     std::unique_ptr<Implementation> pImpl;
 };
 
-#endif // SECURITY_MONITOR_H
\ No newline at end of file
+// Records the enclosing scope as one operation. It counts as failed unless
+// succeed() is called, so exceptions are recorded as failures.
+class OperationTimer
+{
+public:
+    explicit OperationTimer(MonitoredOperation operation)
+        : operation_(operation), start_(std::chrono::steady_clock::now()) {}
+
+    ~OperationTimer()
+    {
+        auto elapsed = std::chrono::steady_clock::now() - start_;
+        SecurityMonitor::recordOperation(
+            operation_,
+            static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count()),
+            succeeded_);
+    }
+
+    OperationTimer(const OperationTimer &) = delete;
+    OperationTimer &operator=(const OperationTimer &) = delete;
+
+    void succeed(bool succeeded = true) { succeeded_ = succeeded; }
+
+private:
+    MonitoredOperation operation_;
+    std::chrono::steady_clock::time_point start_;
+    bool succeeded_{false};
+};
+
+#endif // SECURITY_MONITOR_H
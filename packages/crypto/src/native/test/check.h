@@ -0,0 +1,65 @@
+#ifndef QUANTUM_TEST_CHECK_H
+#define QUANTUM_TEST_CHECK_H
+
+// Minimal assertion helpers for the native test executables. A failed CHECK
+// prints its location and is counted; finish() turns the count into the
+// process exit status that ctest reports.
+
+#include <cstdio>
+#include <exception>
+
+namespace quantum
+{
+    namespace test
+    {
+
+        inline int &failures()
+        {
+            static int count = 0;
+            return count;
+        }
+
+        inline int finish(const char *name)
+        {
+            if (failures() != 0)
+            {
+                std::fprintf(stderr, "%s: %d check(s) failed\n", name, failures());
+                return 1;
+            }
+            std::printf("%s: ok\n", name);
+            return 0;
+        }
+
+    } // namespace test
+} // namespace quantum
+
+#define CHECK(condition)                                                                       \
+    do                                                                                         \
+    {                                                                                          \
+        if (!(condition))                                                                      \
+        {                                                                                      \
+            std::fprintf(stderr, "%s:%d: CHECK(%s) failed\n", __FILE__, __LINE__, #condition); \
+            ++quantum::test::failures();                                                       \
+        }                                                                                      \
+    } while (0)
+
+#define CHECK_THROWS(expression)                                                                \
+    do                                                                                          \
+    {                                                                                           \
+        bool thrown = false;                                                                    \
+        try                                                                                     \
+        {                                                                                       \
+            expression;                                                                         \
+        }                                                                                       \
+        catch (const std::exception &)                                                          \
+        {                                                                                       \
+            thrown = true;                                                                      \
+        }                                                                                       \
+        if (!thrown)                                                                            \
+        {                                                                                       \
+            std::fprintf(stderr, "%s:%d: %s did not throw\n", __FILE__, __LINE__, #expression); \
+            ++quantum::test::failures();                                                        \
+        }                                                                                       \
+    } while (0)
+
+#endif // QUANTUM_TEST_CHECK_H
@@ -0,0 +1,170 @@
+// MerkleTree against a reference tree hashed with OpenSSL.
+//
+// Odd leaf counts (1, 3, 1025) exercise the self-paired last node on every
+// layer. Each proof is taken both from a tree and from the borrowed flat
+// layout, must verify against the reference root, and must stop verifying
+// once its leaf, a sibling, its index or the root is altered.
+
+#include "../merkle.h"
+#include "../thread_pool.h"
+#include "check.h"
+#include <openssl/evp.h>
+#include <cstring>
+#include <vector>
+
+using namespace quantum;
+
+namespace
+{
+    using Node = std::vector<uint8_t>;
+
+    Node sha3(const std::vector<uint8_t> &input)
+    {
+        Node digest(MerkleTree::NODE_SIZE);
+        unsigned int written = 0;
+        CHECK(EVP_Digest(input.data(), input.size(), digest.data(), &written, EVP_sha3_256(), nullptr) == 1);
+        return digest;
+    }
+
+    std::vector<uint8_t> leafData(size_t i)
+    {
+        std::vector<uint8_t> data(i % 50);
+        for (size_t b = 0; b < data.size(); ++b)
+        {
+            data[b] = static_cast<uint8_t>(i + b);
+        }
+        return data;
+    }
+
+    Node referenceRoot(std::vector<Node> layer)
+    {
+        while (layer.size() > 1)
+        {
+            std::vector<Node> parents;
+            for (size_t i = 0; i < layer.size(); i += 2)
+            {
+                const Node &right = i + 1 < layer.size() ? layer[i + 1] : layer[i];
+                std::vector<uint8_t> input = {0x01};
+                input.insert(input.end(), layer[i].begin(), layer[i].end());
+                input.insert(input.end(), right.begin(), right.end());
+                parents.push_back(sha3(input));
+            }
+            layer.swap(parents);
+        }
+        return layer[0];
+    }
+
+    void checkTampered(const MerkleProof &proof, const uint8_t *root)
+    {
+        MerkleProof leaf = proof;
+        leaf.leaf[5] ^= 0x01;
+        CHECK(!MerkleTree::verify(leaf, root));
+
+        for (size_t s = 0; s < proof.siblings.size(); s += MerkleTree::NODE_SIZE)
+        {
+            MerkleProof sibling = proof;
+            sibling.siblings[s + 17] ^= 0x80;
+            CHECK(!MerkleTree::verify(sibling, root));
+        }
+
+        if (!proof.siblings.empty())
+        {
+            MerkleProof truncated = proof;
+            truncated.siblings.resize(truncated.siblings.size() - MerkleTree::NODE_SIZE);
+            CHECK(!MerkleTree::verify(truncated, root));
+
+            MerkleProof index = proof;
+            index.index ^= 1;
+            // Swapping with a self-paired node hashes the same pair
+            if (std::memcmp(proof.siblings.data(), proof.leaf, MerkleTree::NODE_SIZE) != 0)
+            {
+                CHECK(!MerkleTree::verify(index, root));
+            }
+        }
+
+        MerkleProof outOfRange = proof;
+        outOfRange.index |= size_t(1) << (proof.siblings.size() / MerkleTree::NODE_SIZE);
+        CHECK(!MerkleTree::verify(outOfRange, root));
+
+        uint8_t otherRoot[MerkleTree::NODE_SIZE];
+        std::memcpy(otherRoot, root, sizeof(otherRoot));
+        otherRoot[0] ^= 0x01;
+        CHECK(!MerkleTree::verify(proof, otherRoot));
+    }
+
+    void testTree(size_t leafCount, ThreadPool *pool)
+    {
+        std::vector<std::vector<uint8_t>> items;
+        std::vector<const uint8_t *> data;
+        std::vector<size_t> lengths;
+        std::vector<Node> expectedLeaves;
+        for (size_t i = 0; i < leafCount; ++i)
+        {
+            items.push_back(leafData(i));
+            std::vector<uint8_t> input = {0x00};
+            input.insert(input.end(), items.back().begin(), items.back().end());
+            expectedLeaves.push_back(sha3(input));
+        }
+        for (const auto &item : items)
+        {
+            data.push_back(item.data());
+            lengths.push_back(item.size());
+        }
+
+        std::vector<uint8_t> leaves(leafCount * MerkleTree::NODE_SIZE);
+        MerkleTree::hashLeaves(data.data(), lengths.data(), leafCount, leaves.data(), pool);
+        for (size_t i = 0; i < leafCount; ++i)
+        {
+            CHECK(std::memcmp(leaves.data() + i * MerkleTree::NODE_SIZE, expectedLeaves[i].data(),
+                              MerkleTree::NODE_SIZE) == 0);
+        }
+
+        MerkleTree tree = MerkleTree::build(leaves.data(), leafCount, pool);
+        Node root = referenceRoot(expectedLeaves);
+        CHECK(std::memcmp(tree.root(), root.data(), MerkleTree::NODE_SIZE) == 0);
+        CHECK(tree.nodes().size() == MerkleTree::nodeCount(leafCount) * MerkleTree::NODE_SIZE);
+
+        std::vector<MerkleProof> proofs;
+        for (size_t i = 0; i < leafCount; ++i)
+        {
+            MerkleProof borrowed = MerkleTree::proof(tree.nodes().data(), leafCount, i);
+            MerkleProof owned = tree.proof(i);
+            CHECK(borrowed.index == i);
+            CHECK(borrowed.siblings == owned.siblings);
+            CHECK(std::memcmp(borrowed.leaf, expectedLeaves[i].data(), MerkleTree::NODE_SIZE) == 0);
+            CHECK(borrowed.siblings.size() == (tree.depth() - 1) * MerkleTree::NODE_SIZE);
+            CHECK(MerkleTree::verify(borrowed, root.data()));
+            // Tampering every proof of a large tree adds nothing
+            if (i < 8 || i + 8 > leafCount)
+            {
+                checkTampered(borrowed, root.data());
+            }
+            proofs.push_back(borrowed);
+        }
+
+        proofs.back().leaf[0] ^= 0x01;
+        std::vector<uint8_t> results = MerkleTree::verifyBatch(proofs.data(), proofs.size(), root.data(), pool);
+        for (size_t i = 0; i < leafCount; ++i)
+        {
+            CHECK(results[i] == (i + 1 == leafCount ? 0 : 1));
+        }
+
+        CHECK_THROWS(MerkleTree::proof(tree.nodes().data(), leafCount, leafCount));
+        CHECK_THROWS(tree.proof(leafCount));
+    }
+}
+
+int main()
+{
+    ThreadPool pool(4);
+    for (size_t leafCount : {1, 2, 3, 4, 5, 7, 1024, 1025, 3001})
+    {
+        testTree(leafCount, nullptr);
+        testTree(leafCount, &pool);
+    }
+
+    CHECK_THROWS(MerkleTree::build(nullptr, 0));
+    CHECK_THROWS(MerkleTree(std::vector<uint8_t>(3 * MerkleTree::NODE_SIZE), 3));
+
+    return test::finish("merkle");
+}
@@ -0,0 +1,134 @@
+// Miner against a plain OpenSSL SHA3-256 scan.
+//
+// Header prefixes run from empty to well past one 136-byte block, so the
+// midstate ends at every offset around the rate: some leave room for the
+// nonce digits in the final block (four-lane path) and some push the nonce
+// across into a new block (scalar path). For each prefix the first winning
+// nonce found by a single-threaded search must match the scan exactly.
+
+#include "../miner.h"
+#include "check.h"
+#include <openssl/evp.h>
+#include <cstring>
+#include <string>
+#include <vector>
+
+using namespace quantum;
+
+namespace
+{
+    void sha3(const std::vector<uint8_t> &prefix, uint64_t nonce, uint8_t out[32])
+    {
+        std::string preimage(prefix.begin(), prefix.end());
+        preimage += std::to_string(nonce);
+        unsigned int written = 0;
+        CHECK(EVP_Digest(preimage.data(), preimage.size(), out, &written, EVP_sha3_256(), nullptr) == 1);
+    }
+
+    bool meets(const uint8_t hash[32], const uint8_t target[32])
+    {
+        return std::memcmp(hash, target, 32) <= 0;
+    }
+
+    MiningJob makeJob(size_t prefixLength, uint64_t start, uint64_t end, unsigned threads)
+    {
+        MiningJob job;
+        job.headerPrefix.resize(prefixLength);
+        for (size_t i = 0; i < prefixLength; ++i)
+        {
+            job.headerPrefix[i] = static_cast<uint8_t>('a' + (i * 7 + prefixLength) % 26);
+        }
+        job.startNonce = start;
+        job.endNonce = end;
+        // Roughly one winner in 64 nonces.
+        std::memset(job.target, 0xFF, sizeof(job.target));
+        job.target[0] = 0x03;
+        job.threads = threads;
+        job.pinThreads = false;
+        return job;
+    }
+
+    // First winning nonce in [start, end), or end when there is none.
+    uint64_t scan(const MiningJob &job)
+    {
+        uint8_t hash[32];
+        for (uint64_t nonce = job.startNonce; nonce < job.endNonce; ++nonce)
+        {
+            sha3(job.headerPrefix, nonce, hash);
+            if (meets(hash, job.target))
+            {
+                return nonce;
+            }
+        }
+        return job.endNonce;
+    }
+
+    void testFirstWinner(size_t prefixLength, uint64_t start)
+    {
+        MiningJob job = makeJob(prefixLength, start, start + 4096, 1);
+        uint64_t expected = scan(job);
+        MiningResult result = Miner::mine(job);
+
+        CHECK(result.found == (expected != job.endNonce));
+        if (result.found)
+        {
+            CHECK(result.nonce == expected);
+            uint8_t hash[32];
+            sha3(job.headerPrefix, result.nonce, hash);
+            CHECK(std::memcmp(result.hash, hash, 32) == 0);
+        }
+    }
+
+    // With several threads any winner may be reported; it must still be one.
+    void testParallelWinner(size_t prefixLength)
+    {
+        MiningJob job = makeJob(prefixLength, 0, 1 << 16, 4);
+        MiningResult result = Miner::mine(job);
+        CHECK(result.found);
+        if (result.found)
+        {
+            uint8_t hash[32];
+            sha3(job.headerPrefix, result.nonce, hash);
+            CHECK(std::memcmp(result.hash, hash, 32) == 0);
+            CHECK(meets(hash, job.target));
+        }
+    }
+
+    void testNoWinner()
+    {
+        MiningJob job = makeJob(100, 0, 2000, 2);
+        std::memset(job.target, 0, sizeof(job.target));
+        MiningResult result = Miner::mine(job);
+        CHECK(!result.found);
+        CHECK(result.hashes == 2000);
+    }
+
+    void testCancelled()
+    {
+        MiningJob job = makeJob(100, 0, uint64_t(1) << 40, 2);
+        std::memset(job.target, 0, sizeof(job.target));
+        std::atomic<bool> cancel{true};
+        MiningResult result = Miner::mine(job, &cancel);
+        CHECK(!result.found);
+        CHECK(result.hashes == 0);
+    }
+}
+
+int main()
+{
+    for (size_t prefixLength = 0; prefixLength <= 300; ++prefixLength)
+    {
+        // Nonces with 1 to 20 digits shift where the padding lands.
+        testFirstWinner(prefixLength, 0);
+        testFirstWinner(prefixLength, 999999990);
+        testFirstWinner(prefixLength, 18446744073709500000ULL);
+    }
+    for (size_t prefixLength : {0, 115, 116, 120, 135, 136, 137, 271, 272})
+    {
+        testParallelWinner(prefixLength);
+    }
+    testNoWinner();
+    testCancelled();
+
+    return test::finish("miner");
+}
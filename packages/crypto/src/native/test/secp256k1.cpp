@@ -0,0 +1,220 @@
+// Secp256k1::verify against the signatures HybridCrypto produces.
+//
+// HybridCrypto signs with elliptic: ECDSA over SHA-256(message) with an
+// RFC 6979 nonce, no low-S normalisation, DER output. The fixed vectors
+// below were computed with that recipe (one has a high S) and must verify
+// under both the compressed and uncompressed key. Random OpenSSL keys then check that
+// wrong keys, wrong messages, flipped signature bytes, malformed DER and
+// points that are off the curve or badly encoded are all rejected.
+
+#include "../secp256k1.h"
+#include "check.h"
+#include <openssl/ec.h>
+#include <openssl/evp.h>
+#include <openssl/obj_mac.h>
+#include <string>
+#include <vector>
+
+using namespace quantum;
+
+namespace
+{
+    using Bytes = std::vector<uint8_t>;
+
+    Bytes fromHex(const std::string &hex)
+    {
+        Bytes bytes(hex.size() / 2);
+        for (size_t i = 0; i < bytes.size(); ++i)
+        {
+            bytes[i] = static_cast<uint8_t>(std::stoi(hex.substr(2 * i, 2), nullptr, 16));
+        }
+        return bytes;
+    }
+
+    Bytes text(const std::string &value)
+    {
+        return Bytes(value.begin(), value.end());
+    }
+
+    bool verify(const Bytes &message, const Bytes &signature, const Bytes &publicKey)
+    {
+        return Secp256k1::verify(message, signature, publicKey);
+    }
+
+    Bytes compress(const Bytes &uncompressed)
+    {
+        Bytes point(uncompressed.begin(), uncompressed.begin() + 33);
+        point[0] = static_cast<uint8_t>(0x02 | (uncompressed.back() & 1));
+        return point;
+    }
+
+    // Key pair from SHA-256("h3tag secp256k1 test key")
+    const char *VECTOR_KEY =
+        "04b4df81ee3681b494d7060cf82f43a9b68524e18dfc9de5040ba0bb7366d73d36"
+        "c799c68554af3aaa7e41b8c19b142e7cb7f48b61bd6ff9023d3bff316cda8de4";
+
+    struct Vector
+    {
+        const char *message;
+        const char *signature;
+    };
+
+    const Vector VECTORS[] = {
+        {"h3tag hybrid message 0",
+         "3044022076fc1cffd352acbe449ed9fa5889028562d34103231414680f1eba56139d43ca"
+         "0220222c3486cd7d748d367384da25d79b8ee31c06506eca776f113c49e453ed313d"},
+        {"h3tag hybrid message 1",
+         "3044022076964a856a8fa10bdb0aa4f70e2acd9e14bde36e0d1930a7b36e429ed38a8759"
+         "02205d36a0e21753ff934b9ebec4d8c53b72104b3c6c8339f1db53b882c060e88ac0"},
+        // S above n/2, which elliptic emits unless asked for canonical output
+        {"h3tag hybrid message 2",
+         "3046022100831e4245a299b968d0249180fbf8af0a6a7e8fb99e8b217236a9d00433d568f9"
+         "02210087923d46fc11832eeab56a1995d1f509377a2a2057219bd18e7433d318fd98e3"},
+        {"h3tag hybrid message 3",
+         "3045022100c40453cbb1b67e4a021505867bf20fdaac0e851347a07e8a65aab77ab1640bcb"
+         "022065538479240bb9ff236b81f29805e459a0b85a84f969544a8d6506974388c475"},
+    };
+
+    void testHybridCryptoVectors()
+    {
+        Bytes uncompressed = fromHex(VECTOR_KEY);
+        Bytes compressed = compress(uncompressed);
+        CHECK(compressed[0] == 0x02);
+
+        for (const Vector &vector : VECTORS)
+        {
+            Bytes message = text(vector.message);
+            Bytes signature = fromHex(vector.signature);
+            CHECK(verify(message, signature, uncompressed));
+            CHECK(verify(message, signature, compressed));
+
+            Bytes other = message;
+            other.back() ^= 0x01;
+            CHECK(!verify(other, signature, uncompressed));
+        }
+        // A signature for one message does not verify another
+        CHECK(!verify(text(VECTORS[0].message), fromHex(VECTORS[1].signature), uncompressed));
+    }
+
+    struct KeyPair
+    {
+        EVP_PKEY *key{nullptr};
+        Bytes uncompressed;
+
+        KeyPair()
+        {
+            key = EVP_EC_gen(SN_secp256k1);
+            CHECK(key != nullptr);
+            unsigned char *encoded = nullptr;
+            size_t length = key ? EVP_PKEY_get1_encoded_public_key(key, &encoded) : 0;
+            CHECK(length == 65);
+            uncompressed.assign(encoded, encoded + length);
+            OPENSSL_free(encoded);
+        }
+
+        ~KeyPair()
+        {
+            EVP_PKEY_free(key);
+        }
+
+        Bytes sign(const Bytes &message) const
+        {
+            EVP_MD_CTX *ctx = EVP_MD_CTX_new();
+            size_t length = 0;
+            bool ok = EVP_DigestSignInit(ctx, nullptr, EVP_sha256(), nullptr, key) == 1 &&
+                      EVP_DigestSign(ctx, nullptr, &length, message.data(), message.size()) == 1;
+            Bytes signature(length);
+            ok = ok && EVP_DigestSign(ctx, signature.data(), &length, message.data(), message.size()) == 1;
+            EVP_MD_CTX_free(ctx);
+            CHECK(ok);
+            signature.resize(length);
+            return signature;
+        }
+    };
+
+    void testGeneratedKeys()
+    {
+        for (int round = 0; round < 16; ++round)
+        {
+            KeyPair signer;
+            KeyPair other;
+            Bytes message = text("block header " + std::to_string(round));
+            Bytes signature = signer.sign(message);
+
+            CHECK(verify(message, signature, signer.uncompressed));
+            CHECK(verify(message, signature, compress(signer.uncompressed)));
+            CHECK(!verify(message, signature, other.uncompressed));
+            CHECK(!verify(message, signature, compress(other.uncompressed)));
+
+            // Every single-bit flip breaks either the DER or the values
+            for (size_t i = 0; i < signature.size(); ++i)
+            {
+                Bytes flipped = signature;
+                flipped[i] ^= static_cast<uint8_t>(1u << (i % 8));
+                CHECK(!verify(message, flipped, signer.uncompressed));
+            }
+
+            Bytes truncated(signature.begin(), signature.end() - 1);
+            CHECK(!verify(message, truncated, signer.uncompressed));
+            Bytes trailing = signature;
+            trailing.push_back(0x00);
+            CHECK(!verify(message, trailing, signer.uncompressed));
+            CHECK(!verify(message, Bytes(), signer.uncompressed));
+
+            // The wrong parity byte names the negated point
+            Bytes negated = compress(signer.uncompressed);
+            negated[0] ^= 0x01;
+            CHECK(!verify(message, signature, negated));
+        }
+    }
+
+    void testMalformedKeys()
+    {
+        Bytes message = text(VECTORS[0].message);
+        Bytes signature = fromHex(VECTORS[0].signature);
+        Bytes uncompressed = fromHex(VECTOR_KEY);
+
+        // Changing y by one puts the point off the curve
+        Bytes offCurve = uncompressed;
+        offCurve.back() ^= 0x01;
+        CHECK(!verify(message, signature, offCurve));
+
+        // x = 5 has no point: 5^3 + 7 is not a square mod p
+        Bytes noPoint(33, 0);
+        noPoint[0] = 0x02;
+        noPoint[32] = 0x05;
+        CHECK(!verify(message, signature, noPoint));
+
+        // x >= p
+        Bytes outOfField(33, 0xFF);
+        outOfField[0] = 0x02;
+        CHECK(!verify(message, signature, outOfField));
+
+        Bytes badPrefix = uncompressed;
+        badPrefix[0] = 0x05;
+        CHECK(!verify(message, signature, badPrefix));
+
+        Bytes rawCoordinates(uncompressed.begin() + 1, uncompressed.end());
+        CHECK(!verify(message, signature, rawCoordinates));
+        CHECK(!verify(message, signature, Bytes{0x00}));
+        CHECK(!verify(message, signature, Bytes()));
+
+        Bytes digest(31, 0);
+        CHECK(!Secp256k1::verifyDigest(digest, signature, uncompressed));
+    }
+}
+
+int main()
+{
+    CHECK(Secp256k1::available());
+    if (!Secp256k1::available())
+    {
+        return test::finish("secp256k1");
+    }
+
+    testHybridCryptoVectors();
+    testGeneratedKeys();
+    testMalformedKeys();
+
+    return test::finish("secp256k1");
+}
@@ -0,0 +1,194 @@
+// SecureArena thread caches, checked through stats().
+//
+// Blocks allocated on one thread and freed on another (the JS-thread
+// finalizer pattern) must go back to the secure heap rather than pile up in
+// the freeing thread's cache. A thread that allocates and frees recycles its
+// own blocks, and however many threads do so, the caches together stay
+// within their share of the heap and are emptied when the threads exit.
+// Once the heap is full, allocations fall back to ordinary memory and are
+// counted instead of failing, and public buffers never draw from it.
+
+#include "../secure_arena.h"
+#include "../memory.h"
+#include "check.h"
+#include <condition_variable>
+#include <cstring>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+using namespace quantum;
+
+namespace
+{
+    constexpr size_t HEAP_BYTES = size_t(1) << 21;
+    constexpr size_t BLOCK = 2420; // ML-DSA-44 signature, 4 KiB class
+
+    std::vector<void *> allocateBlocks(size_t count, size_t bytes)
+    {
+        std::vector<void *> blocks;
+        for (size_t i = 0; i < count; ++i)
+        {
+            void *ptr = SecureArena::allocate(bytes);
+            CHECK(ptr != nullptr);
+            blocks.push_back(ptr);
+        }
+        return blocks;
+    }
+
+    void freeBlocks(const std::vector<void *> &blocks, size_t bytes)
+    {
+        for (void *ptr : blocks)
+        {
+            SecureArena::deallocate(ptr, bytes);
+        }
+    }
+
+    void testCrossThreadFree()
+    {
+        size_t usedBefore = SecureArena::stats().heapUsed;
+
+        for (int round = 0; round < 4; ++round)
+        {
+            std::vector<void *> blocks;
+            std::thread producer([&blocks]()
+                                 { blocks = allocateBlocks(32, BLOCK); });
+            producer.join();
+
+            std::thread consumer([&blocks]()
+                                 {
+                freeBlocks(blocks, BLOCK);
+                // Nothing was allocated here, so nothing may be cached
+                CHECK(SecureArena::stats().cachedBytes == 0); });
+            consumer.join();
+        }
+
+        SecureArenaStats stats = SecureArena::stats();
+        CHECK(stats.cachedBytes == 0);
+        CHECK(stats.heapUsed == usedBefore);
+        CHECK(stats.fallbacks == 0);
+    }
+
+    void testSameThreadReuse()
+    {
+        std::thread worker([]()
+                           {
+            uint64_t hitsBefore = SecureArena::stats().cacheHits;
+            for (int round = 0; round < 10; ++round)
+            {
+                freeBlocks(allocateBlocks(4, BLOCK), BLOCK);
+            }
+            SecureArenaStats stats = SecureArena::stats();
+            CHECK(stats.cacheHits - hitsBefore == 36);
+            CHECK(stats.cachedBytes == 4 * 4096); });
+        worker.join();
+
+        // The cache is returned when its thread exits
+        CHECK(SecureArena::stats().cachedBytes == 0);
+    }
+
+    void testGlobalBound()
+    {
+        const size_t threads = 16;
+        std::mutex mutex;
+        std::condition_variable cv;
+        size_t ready = 0;
+        bool release = false;
+
+        // Every thread fills its cache and waits, so all caches are full at once
+        std::vector<std::thread> workers;
+        for (size_t t = 0; t < threads; ++t)
+        {
+            workers.emplace_back([&]()
+                                 {
+                for (size_t bytes : {64, 2420, 4000, 8192})
+                {
+                    freeBlocks(allocateBlocks(64, bytes), bytes);
+                }
+                std::unique_lock<std::mutex> lock(mutex);
+                ++ready;
+                cv.notify_all();
+                cv.wait(lock, [&]()
+                        { return release; }); });
+        }
+
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            cv.wait(lock, [&]()
+                    { return ready == threads; });
+            SecureArenaStats stats = SecureArena::stats();
+            CHECK(stats.cachedBytes > 0);
+            CHECK(stats.cachedBytes <= HEAP_BYTES / 8);
+            CHECK(stats.fallbacks == 0);
+            release = true;
+            cv.notify_all();
+        }
+        for (auto &worker : workers)
+        {
+            worker.join();
+        }
+
+        CHECK(SecureArena::stats().cachedBytes == 0);
+    }
+
+    void testExhaustion()
+    {
+        // Twice the heap in 16 KiB blocks, then blocks larger than the heap
+        const size_t classBlock = SecureArena::MAX_CACHED_SIZE;
+        std::vector<void *> blocks = allocateBlocks(2 * HEAP_BYTES / classBlock, classBlock);
+        std::vector<void *> large = allocateBlocks(2, 2 * HEAP_BYTES);
+
+        SecureArenaStats stats = SecureArena::stats();
+        CHECK(stats.fallbacks >= HEAP_BYTES / classBlock + 2);
+        CHECK(stats.heapUsed <= stats.heapSize);
+
+        // Every block is usable, wherever it came from
+        for (void *ptr : blocks)
+        {
+            std::memset(ptr, 0xA5, classBlock);
+        }
+        std::memset(large[0], 0xA5, 2 * HEAP_BYTES);
+
+        // Secrets still allocate on a full heap; public data never uses it
+        uint64_t fallbacks = stats.fallbacks;
+        PrivateKey key(4896);
+        CHECK(key.kind() == MemoryKind::SECURE);
+        CHECK(SecureArena::stats().fallbacks == fallbacks + 1);
+
+        size_t used = SecureArena::stats().heapUsed;
+        std::vector<Signature> signatures;
+        for (int i = 0; i < 512; ++i)
+        {
+            signatures.emplace_back(4627); // ML-DSA-87 signature
+            CHECK(signatures.back().kind() == MemoryKind::ORDINARY);
+        }
+        CHECK(SecureArena::stats().heapUsed == used);
+
+        freeBlocks(blocks, classBlock);
+        freeBlocks(large, 2 * HEAP_BYTES);
+
+        // With room again, secrets go back to the secure heap
+        fallbacks = SecureArena::stats().fallbacks;
+        SharedSecret secret(32);
+        CHECK(SecureArena::stats().fallbacks == fallbacks);
+    }
+}
+
+int main()
+{
+    CHECK(SecureArena::initialize(HEAP_BYTES));
+    if (!SecureArena::stats().initialized)
+    {
+        return test::finish("secure_arena");
+    }
+
+    testCrossThreadFree();
+    testSameThreadReuse();
+    testGlobalBound();
+    testExhaustion();
+
+    SecureArenaStats stats = SecureArena::stats();
+    CHECK(stats.bytesInUse == 0);
+
+    return test::finish("secure_arena");
+}
@@ -0,0 +1,227 @@
+// VerifyCache keys, bounds and the verify paths that use it.
+//
+// A cached outcome must only ever be returned for the exact (parameter set,
+// message, signature, public key) it was computed for: in particular a
+// cached failure must never let a different signature or key through, and
+// moving bytes between fields must change the key. Capacity 0 disables the
+// cache, and eviction keeps every shard within its share of the capacity.
+
+#include "../verify_cache.h"
+#include "../quantum.h"
+#include "check.h"
+#include <cstring>
+#include <set>
+#include <vector>
+
+using namespace quantum;
+
+namespace
+{
+    using Bytes = std::vector<uint8_t>;
+
+    Bytes bytes(size_t length, uint8_t seed)
+    {
+        Bytes data(length);
+        for (size_t i = 0; i < length; ++i)
+        {
+            data[i] = static_cast<uint8_t>(seed + i * 13);
+        }
+        return data;
+    }
+
+    VerifyCache::Key keyOf(const VerifyCache &cache, uint8_t scheme, const Bytes &message, const Bytes &signature,
+                           const Bytes &publicKey)
+    {
+        return cache.key(scheme, message.data(), message.size(), signature.data(), signature.size(),
+                         publicKey.data(), publicKey.size());
+    }
+
+    // A key that lands in the given shard (shardFor reads bytes 8..15).
+    VerifyCache::Key shardKey(size_t shard, size_t shards, uint64_t serial)
+    {
+        VerifyCache::Key key{};
+        std::memcpy(key.data(), &serial, sizeof(serial));
+        uint64_t selector = shard + shards * serial;
+        std::memcpy(key.data() + 8, &selector, sizeof(selector));
+        return key;
+    }
+
+    void testDistinctKeys()
+    {
+        VerifyCache cache(1024);
+        const Bytes message = bytes(64, 1);
+        const Bytes signature = bytes(96, 2);
+        const Bytes publicKey = bytes(48, 3);
+
+        std::set<VerifyCache::Key> keys;
+        keys.insert(keyOf(cache, 0, message, signature, publicKey));
+
+        // Same bytes under another scheme or parameter set
+        keys.insert(keyOf(cache, 1, message, signature, publicKey));
+        keys.insert(keyOf(cache, 0x10, message, signature, publicKey));
+
+        // One changed byte in each field
+        for (const Bytes *field : {&message, &signature, &publicKey})
+        {
+            Bytes changed = *field;
+            changed[changed.size() / 2] ^= 0x01;
+            keys.insert(keyOf(cache, 0,
+                              field == &message ? changed : message,
+                              field == &signature ? changed : signature,
+                              field == &publicKey ? changed : publicKey));
+        }
+
+        // Bytes moved across a field boundary keep the concatenation but
+        // not the length prefixes
+        Bytes longerMessage = message;
+        longerMessage.push_back(signature[0]);
+        Bytes shorterSignature(signature.begin() + 1, signature.end());
+        keys.insert(keyOf(cache, 0, longerMessage, shorterSignature, publicKey));
+
+        Bytes longerSignature = signature;
+        longerSignature.push_back(publicKey[0]);
+        Bytes shorterKey(publicKey.begin() + 1, publicKey.end());
+        keys.insert(keyOf(cache, 0, message, longerSignature, shorterKey));
+
+        Bytes empty;
+        Bytes all = message;
+        all.insert(all.end(), signature.begin(), signature.end());
+        keys.insert(keyOf(cache, 0, all, empty, publicKey));
+        keys.insert(keyOf(cache, 0, empty, all, publicKey));
+
+        // Prepared-key form of the same inputs
+        VerifyCache::Key digest = cache.publicKeyDigest(0, publicKey.data(), publicKey.size());
+        keys.insert(cache.key(digest, message.data(), message.size(), signature.data(), signature.size()));
+        keys.insert(digest);
+
+        CHECK(keys.size() == 12);
+
+        // The key is deterministic within a cache and salted across caches
+        CHECK(keyOf(cache, 0, message, signature, publicKey) == keyOf(cache, 0, message, signature, publicKey));
+        VerifyCache other(1024);
+        CHECK(keyOf(cache, 0, message, signature, publicKey) != keyOf(other, 0, message, signature, publicKey));
+    }
+
+    void testNegativeEntries()
+    {
+        VerifyCache cache(1024);
+        const Bytes message = bytes(64, 1);
+        const Bytes signature = bytes(96, 2);
+        const Bytes publicKey = bytes(48, 3);
+
+        VerifyCache::Key rejected = keyOf(cache, 0, message, signature, publicKey);
+        cache.insert(rejected, false);
+
+        bool valid = true;
+        CHECK(cache.lookup(rejected, valid));
+        CHECK(!valid);
+
+        Bytes otherSignature = signature;
+        otherSignature.back() ^= 0x01;
+        Bytes otherKey = publicKey;
+        otherKey[0] ^= 0x01;
+        CHECK(!cache.lookup(keyOf(cache, 0, message, otherSignature, publicKey), valid));
+        CHECK(!cache.lookup(keyOf(cache, 0, message, signature, otherKey), valid));
+        CHECK(!cache.lookup(keyOf(cache, 1, message, signature, publicKey), valid));
+
+        VerifyCacheStats stats = cache.stats();
+        CHECK(stats.hits == 1);
+        CHECK(stats.negativeHits == 1);
+        CHECK(stats.misses == 3);
+    }
+
+    void testDisabled()
+    {
+        VerifyCache cache(0);
+        CHECK(!cache.enabled());
+
+        VerifyCache::Key key = shardKey(0, 16, 1);
+        cache.insert(key, true);
+        bool valid = false;
+        CHECK(!cache.lookup(key, valid));
+
+        VerifyCacheStats stats = cache.stats();
+        CHECK(stats.entries == 0);
+        CHECK(stats.insertions == 0);
+        CHECK(stats.capacity == 0);
+    }
+
+    void testShardBound()
+    {
+        const size_t shards = 4;
+        VerifyCache cache(8, shards); // two entries per shard
+
+        // Overfill shard 0 only; the other shards keep their entries
+        for (size_t s = 1; s < shards; ++s)
+        {
+            cache.insert(shardKey(s, shards, 0), true);
+        }
+        for (uint64_t serial = 0; serial < 10; ++serial)
+        {
+            cache.insert(shardKey(0, shards, serial), serial % 2 == 0);
+        }
+
+        VerifyCacheStats stats = cache.stats();
+        CHECK(stats.entries == 2 + (shards - 1));
+        CHECK(stats.evictions == 8);
+
+        bool valid = false;
+        CHECK(cache.lookup(shardKey(0, shards, 8), valid) && valid);
+        CHECK(cache.lookup(shardKey(0, shards, 9), valid) && !valid);
+        CHECK(!cache.lookup(shardKey(0, shards, 7), valid));
+        for (size_t s = 1; s < shards; ++s)
+        {
+            CHECK(cache.lookup(shardKey(s, shards, 0), valid) && valid);
+        }
+
+        // Least recently used goes first: touch 8, then 9 is evicted
+        CHECK(cache.lookup(shardKey(0, shards, 8), valid));
+        cache.insert(shardKey(0, shards, 10), true);
+        CHECK(cache.lookup(shardKey(0, shards, 8), valid));
+        CHECK(!cache.lookup(shardKey(0, shards, 9), valid));
+
+        // Filling every shard never exceeds shards * per-shard capacity
+        for (uint64_t serial = 0; serial < 1000; ++serial)
+        {
+            cache.insert(shardKey(serial % shards, shards, 100 + serial), true);
+        }
+        CHECK(cache.stats().entries == 8);
+
+        cache.clear();
+        CHECK(cache.stats().entries == 0);
+    }
+
+    // End to end: a cached rejection must not affect other inputs.
+    void testVerifyPath()
+    {
+        QuantumCrypto &crypto = QuantumCrypto::getInstance();
+        const SecurityLevel level = SecurityLevel::LEGACY;
+        KeyPair first = crypto.generateDilithiumKeyPair(level);
+        KeyPair second = crypto.generateDilithiumKeyPair(level);
+
+        Bytes message = bytes(200, 9);
+        Signature signature = crypto.sign(level, message, first.privateKey);
+        Signature forged(signature.size());
+        std::memcpy(forged.data(), signature.data(), signature.size());
+        forged.data()[forged.size() - 1] ^= 0x01;
+
+        for (int round = 0; round < 2; ++round)
+        {
+            CHECK(!crypto.verify(level, message, forged, first.publicKey));
+            CHECK(!crypto.verify(level, message, signature, second.publicKey));
+            CHECK(crypto.verify(level, message, signature, first.publicKey));
+        }
+        CHECK(crypto.verifyCacheStats().negativeHits >= 2);
+    }
+}
+
+int main()
+{
+    testDistinctKeys();
+    testNegativeEntries();
+    testDisabled();
+    testShardBound();
+    testVerifyPath();
+
+    return test::finish("verify_cache");
+}
@@ -0,0 +1,154 @@
+#include "thread_pool.h"
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace quantum
+{
+
+    struct ThreadPool::Implementation
+    {
+        std::mutex mutex;
+        std::condition_variable available;
+        std::deque<std::function<void()>> tasks;
+        std::vector<std::thread> workers;
+        bool stopping{false};
+
+        void run()
+        {
+            for (;;)
+            {
+                std::function<void()> task;
+                {
+                    std::unique_lock<std::mutex> lock(mutex);
+                    available.wait(lock, [this]()
+                                   { return stopping || !tasks.empty(); });
+                    if (stopping && tasks.empty())
+                    {
+                        return;
+                    }
+                    task = std::move(tasks.front());
+                    tasks.pop_front();
+                }
+                task();
+            }
+        }
+    };
+
+    // Shared between the caller of parallelFor and the helper tasks it queues.
+    // Helpers that start after every index has been claimed exit immediately,
+    // so the caller only waits for claimed items, never for queued helpers.
+    struct ParallelForState
+    {
+        explicit ParallelForState(size_t total, const std::function<void(size_t)> &body)
+            : count(total), fn(body) {}
+
+        const size_t count;
+        const std::function<void(size_t)> &fn;
+        std::atomic<size_t> next{0};
+        std::atomic<size_t> completed{0};
+        std::mutex mutex;
+        std::condition_variable finished;
+        std::exception_ptr error;
+
+        void drain()
+        {
+            size_t index;
+            while ((index = next.fetch_add(1, std::memory_order_relaxed)) < count)
+            {
+                try
+                {
+                    fn(index);
+                }
+                catch (...)
+                {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    if (!error)
+                    {
+                        error = std::current_exception();
+                    }
+                }
+                if (completed.fetch_add(1, std::memory_order_acq_rel) + 1 == count)
+                {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    finished.notify_all();
+                }
+            }
+        }
+    };
+
+    ThreadPool::ThreadPool(size_t threads)
+        : pImpl(std::make_unique<Implementation>())
+    {
+        if (threads == 0)
+        {
+            threads = std::max<size_t>(1, std::thread::hardware_concurrency());
+        }
+
+        pImpl->workers.reserve(threads);
+        for (size_t i = 0; i < threads; ++i)
+        {
+            pImpl->workers.emplace_back([this]()
+                                        { pImpl->run(); });
+        }
+    }
+
+    ThreadPool::~ThreadPool()
+    {
+        {
+            std::lock_guard<std::mutex> lock(pImpl->mutex);
+            pImpl->stopping = true;
+        }
+        pImpl->available.notify_all();
+        for (auto &worker : pImpl->workers)
+        {
+            worker.join();
+        }
+    }
+
+    void ThreadPool::submit(std::function<void()> task)
+    {
+        {
+            std::lock_guard<std::mutex> lock(pImpl->mutex);
+            pImpl->tasks.push_back(std::move(task));
+        }
+        pImpl->available.notify_one();
+    }
+
+    void ThreadPool::parallelFor(size_t count, const std::function<void(size_t)> &fn)
+    {
+        if (count == 0)
+        {
+            return;
+        }
+
+        auto state = std::make_shared<ParallelForState>(count, fn);
+        size_t helpers = std::min(pImpl->workers.size(), count - 1);
+        for (size_t i = 0; i < helpers; ++i)
+        {
+            submit([state]()
+                   { state->drain(); });
+        }
+
+        state->drain();
+
+        std::unique_lock<std::mutex> lock(state->mutex);
+        state->finished.wait(lock, [&state]()
+                             { return state->completed.load(std::memory_order_acquire) == state->count; });
+        if (state->error)
+        {
+            std::rethrow_exception(state->error);
+        }
+    }
+
+    size_t ThreadPool::size() const
+    {
+        return pImpl->workers.size();
+    }
+
+} // namespace quantum
@@ -0,0 +1,40 @@
+#ifndef THREAD_POOL_H
+#define THREAD_POOL_H
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+
+namespace quantum
+{
+
+    // Fixed-size worker pool used to fan native crypto work out across cores.
+    class ThreadPool
+    {
+    public:
+        // A thread count of 0 uses std::thread::hardware_concurrency().
+        explicit ThreadPool(size_t threads = 0);
+        ~ThreadPool();
+
+        ThreadPool(const ThreadPool &) = delete;
+        ThreadPool &operator=(const ThreadPool &) = delete;
+
+        // Queue a task for execution on a worker thread.
+        void submit(std::function<void()> task);
+
+        // Run fn(i) for every i in [0, count) and block until all calls have
+        // returned. The calling thread takes part in the work, so this is safe
+        // to call from inside a pool task. The first exception thrown by fn is
+        // rethrown to the caller once the remaining items have drained.
+        void parallelFor(size_t count, const std::function<void(size_t)> &fn);
+
+        size_t size() const;
+
+    private:
+        struct Implementation;
+        std::unique_ptr<Implementation> pImpl;
+    };
+
+} // namespace quantum
+
+#endif // THREAD_POOL_H
@@ -1,7 +1,24 @@
 export enum SecurityLevel {
-  NORMAL = 1,
-  HIGH = 2,
-  PARANOID = 3,
+  LEGACY = 0, // Dilithium5 / Kyber1024
+  NORMAL = 1, // ML-DSA-44 / ML-KEM-512
+  HIGH = 2, // ML-DSA-65 / ML-KEM-768
+  PARANOID = 3, // ML-DSA-87 / ML-KEM-1024
+}
+
+export type FalconVariant = 512 | 1024;
+
+export interface ParameterSetInfo {
+  level: SecurityLevel;
+  available: boolean;
+  signatureAlgorithm: string;
+  kemAlgorithm: string;
+  publicKeyLength: number;
+  privateKeyLength: number;
+  signatureLength: number;
+  kemPublicKeyLength: number;
+  kemPrivateKeyLength: number;
+  ciphertextLength: number;
+  sharedSecretLength: number;
 }
 
 export interface QuantumKeyPair {
@@ -9,30 +26,380 @@ export interface QuantumKeyPair {
   privateKey: Buffer;
 }
 
+export type KeyPairAlgorithm = 'dilithium' | 'kyber';
+
+// Key pair i is publicKeys[i * publicKeyLength, (i + 1) * publicKeyLength)
+// and the matching slice of privateKeys.
+export interface KeyPairBatch {
+  count: number;
+  publicKeyLength: number;
+  privateKeyLength: number;
+  publicKeys: Buffer;
+  privateKeys: Buffer;
+}
+
 export interface KyberEncapsulation {
   ciphertext: Buffer;
   sharedSecret: Buffer;
 }
 
+// Item i's ciphertext and shared secret are the i-th slices of each Buffer
+export interface KyberEncapsulationBatch {
+  count: number;
+  ciphertextLength: number;
+  sharedSecretLength: number;
+  ciphertexts: Buffer;
+  sharedSecrets: Buffer;
+}
+
 export interface HybridKeys {
   traditional: string;
   dilithium: string;
   kyber: string;
 }
 
+export interface VerifyBatchItem {
+  message: Buffer;
+  signature: Buffer;
+  publicKey: Buffer;
+}
+
+// Both signatures must verify: secp256k1 ECDSA over SHA-256(message), with
+// a DER signature and SEC1 public key, and Dilithium over the message
+export interface HybridVerifyItem {
+  message: Buffer;
+  ecdsaSignature: Buffer;
+  ecdsaPublicKey: Buffer;
+  signature: Buffer;
+  publicKey: Buffer;
+}
+
+export interface VerifyBatchResult {
+  bitmap: Buffer; // bit i (LSB first) set when item i verified
+  validCount: number;
+  allValid: boolean;
+  aborted: boolean;
+}
+
+export interface NativeMiningOptions {
+  headerBase: string | Buffer;
+  start: number;
+  end: number; // exclusive
+  target: Buffer; // 32-byte big-endian
+  threads?: number; // defaults to one per core
+  pinThreads?: boolean; // pin thread i to core coreOffset + i; default false
+  coreOffset?: number; // first core to pin to; give each caller its own
+  generation?: number; // from getMiningGeneration(); cancelled once stale
+}
+
+export interface NativeMiningResult {
+  found: boolean;
+  nonce?: number;
+  hash?: Buffer;
+  cancelled: boolean;
+  hashes: number;
+  hashRate: number;
+}
+
+export interface NativeMerkleTree {
+  root: Buffer;
+  nodes: Buffer; // every layer as 32-byte nodes, leaves first
+  leafCount: number;
+}
+
+export interface NativeMerkleProof {
+  index: number;
+  leaf: Buffer; // 32-byte leaf hash
+  siblings: Buffer[];
+}
+
+export interface SecureMemoryStats {
+  initialized: boolean; // OpenSSL secure heap active
+  locked: boolean; // pages mlocked and excluded from core dumps
+  heapSize: number;
+  heapUsed: number;
+  bytesInUse: number;
+  highWater: number;
+  allocations: number;
+  cacheHits: number;
+  cachedBytes: number; // held in per-thread caches across all threads
+  fallbacks: number; // allocations that fell back to the normal heap
+}
+
+export interface VerifyCacheStats {
+  hits: number;
+  negativeHits: number; // hits on known-invalid signatures
+  misses: number;
+  insertions: number;
+  evictions: number;
+  entries: number;
+  capacity: number;
+}
+
+export interface PreparedKeyStats {
+  hits: number; // preparePublicKey calls served from the native cache
+  misses: number;
+  evictions: number;
+  entries: number;
+  capacity: number;
+}
+
+// Process-wide counters of the per-thread DRBGs behind randomBytes()
+export interface EntropyStats {
+  bytesGenerated: number;
+  requests: number;
+  instantiations: number; // DRBGs seeded from the OS
+  forkReseeds: number; // DRBGs replaced after fork()
+  failures: number;
+  healthy: boolean;
+}
+
+// Native security failure log; suppressed messages exceeded the per-message
+// rate limit, dropped ones found the queue full
+export interface SecurityLogStats {
+  queued: number;
+  written: number;
+  suppressed: number;
+  dropped: number;
+}
+
+export type MonitoredOperation =
+  | 'keygen'
+  | 'sign'
+  | 'verify'
+  | 'encapsulate'
+  | 'decapsulate'
+  | 'queue_wait';
+
+// Native latency snapshot. Counts are cumulative; the quantiles cover a
+// sliding window of the last one to two minutes.
+export interface OperationMetrics {
+  operation: MonitoredOperation;
+  count: number;
+  failures: number;
+  totalMicros: number;
+  windowCount: number;
+  p50Micros: number;
+  p90Micros: number;
+  p99Micros: number;
+  p999Micros: number;
+  maxMicros: number;
+}
+
+// Native known-answer health check. failures is a bitmask of the checks that
+// failed in the latest run; pending is set until the first run completes.
+export interface HealthStatus {
+  failures: number;
+  healthy: boolean;
+  pending: boolean;
+  runs: number;
+  lastRunMillis: number; // wall clock time of the latest run
+  lastDurationMicros: number;
+}
+
+export type KeyPoolKind = 'dilithium' | 'kyber' | 'falcon';
+
+export type PrehashKind = 'dilithium' | 'falcon';
+
+// Opaque native state of a streaming (pre-hashed) signature
+export type PrehashHandle = { readonly __prehashHandle: unique symbol };
+
+export type PreparedKeyKind = 'dilithium' | 'falcon';
+
+// Opaque native state of a validated, pre-digested public key
+export type PreparedKeyHandle = { readonly __preparedKeyHandle: unique symbol };
+
+// Opaque reference to a private key loaded into native secure memory. The
+// key is unloaded when the handle is garbage collected, if not before.
+export type PrivateKeyHandle = { readonly __privateKeyHandle: unique symbol };
+
+export interface PreparedVerifyItem {
+  message: Buffer;
+  signature: Buffer;
+}
+
+export interface KeyPoolStats {
+  algorithm: string;
+  depth: number;
+  available: number;
+  hits: number; // key pairs served from the pool
+  misses: number; // requests that found the pool empty
+  generated: number;
+}
+
+export type HashAlgorithm =
+  | 'sha3-256'
+  | 'sha3-512'
+  | 'shake128'
+  | 'shake256'
+  | 'sha256';
+
 export interface NativeQuantum {
-  generateDilithiumPair(entropy?: Buffer): Promise<QuantumKeyPair>;
-  kyberGenerateKeyPair(): Promise<QuantumKeyPair>;
-  dilithiumSign(message: Buffer, privateKey: Buffer): Promise<Buffer>;
+  generateDilithiumPair(
+    entropy?: Buffer,
+    level?: SecurityLevel,
+  ): Promise<QuantumKeyPair>;
+  kyberGenerateKeyPair(level?: SecurityLevel): Promise<QuantumKeyPair>;
+  generateKeyPairsBatch(
+    algorithm: KeyPairAlgorithm,
+    count: number,
+    level?: SecurityLevel,
+  ): Promise<KeyPairBatch>;
+  dilithiumSign(
+    message: Buffer,
+    privateKey: Buffer,
+    level?: SecurityLevel,
+  ): Promise<Buffer>;
+  loadPrivateKey(
+    privateKey: Buffer,
+    level?: SecurityLevel,
+  ): PrivateKeyHandle;
+  signWithHandle(handle: PrivateKeyHandle, message: Buffer): Promise<Buffer>;
+  unloadPrivateKey(handle: PrivateKeyHandle): boolean;
+  loadKyberPrivateKey(
+    privateKey: Buffer,
+    level?: SecurityLevel,
+  ): PrivateKeyHandle;
+  kyberDecapsulateWithHandle(
+    handle: PrivateKeyHandle,
+    ciphertext: Buffer,
+  ): Promise<Buffer>;
+  kyberDecapsulateBatchWithHandle(
+    handle: PrivateKeyHandle,
+    ciphertexts: Buffer[],
+  ): Promise<Buffer>;
+  prehashInit(
+    kind: PrehashKind,
+    levelOrVariant?: SecurityLevel | FalconVariant,
+    context?: Buffer,
+  ): PrehashHandle;
+  prehashUpdate(handle: PrehashHandle, data: Buffer): void;
+  prehashSign(handle: PrehashHandle, privateKey: Buffer): Promise<Buffer>;
+  prehashVerify(
+    handle: PrehashHandle,
+    signature: Buffer,
+    publicKey: Buffer,
+  ): Promise<boolean>;
   dilithiumVerify(
     message: Buffer,
     signature: Buffer,
     publicKey: Buffer,
+    level?: SecurityLevel,
   ): Promise<boolean>;
-  kyberEncapsulate(publicKey: Buffer): Promise<KyberEncapsulation>;
-  kyberDecapsulate(ciphertext: Buffer, privateKey: Buffer): Promise<Buffer>;
+  dilithiumVerifyBatch(
+    items: VerifyBatchItem[],
+    earlyAbort?: boolean,
+    level?: SecurityLevel,
+  ): Promise<VerifyBatchResult>;
+  verifyHybrid(
+    message: Buffer,
+    ecdsaSignature: Buffer,
+    ecdsaPublicKey: Buffer,
+    signature: Buffer,
+    publicKey: Buffer,
+    level?: SecurityLevel,
+  ): Promise<boolean>;
+  verifyHybridBatch(
+    items: HybridVerifyItem[],
+    earlyAbort?: boolean,
+    level?: SecurityLevel,
+  ): Promise<VerifyBatchResult>;
+  generateFalconKeyPair(variant?: FalconVariant): Promise<QuantumKeyPair>;
+  falconSign(
+    message: Buffer,
+    privateKey: Buffer,
+    variant?: FalconVariant,
+  ): Promise<Buffer>;
+  falconVerify(
+    message: Buffer,
+    signature: Buffer,
+    publicKey: Buffer,
+    variant?: FalconVariant,
+  ): Promise<boolean>;
+  falconVerifyBatch(
+    items: VerifyBatchItem[],
+    earlyAbort?: boolean,
+    variant?: FalconVariant,
+  ): Promise<VerifyBatchResult>;
+  kyberEncapsulate(
+    publicKey: Buffer,
+    level?: SecurityLevel,
+  ): Promise<KyberEncapsulation>;
+  kyberDecapsulate(
+    ciphertext: Buffer,
+    privateKey: Buffer,
+    level?: SecurityLevel,
+  ): Promise<Buffer>;
+  kyberEncapsulateBatch(
+    publicKeys: Buffer[],
+    level?: SecurityLevel,
+  ): Promise<KyberEncapsulationBatch>;
+  kyberDecapsulateBatch(
+    ciphertexts: Buffer[],
+    privateKey: Buffer,
+    level?: SecurityLevel,
+  ): Promise<Buffer>;
   dilithiumHash(data: Buffer): Promise<Buffer>;
   kyberHash(data: Buffer): Promise<Buffer>;
   setSecurityLevel(level: SecurityLevel): Promise<void>;
+  getSecurityLevel(): SecurityLevel;
+  getParameterSet(level?: SecurityLevel): ParameterSetInfo;
   hash(data: Buffer): Promise<Buffer>;
+  hashBatch(
+    algorithm: HashAlgorithm,
+    items: Buffer[],
+    outputLength?: number,
+  ): Promise<Buffer>;
+  getHashBackend(): string;
+  merkleBuild(
+    leaves: Buffer[],
+    prehashed?: boolean,
+  ): Promise<NativeMerkleTree>;
+  merkleProof(
+    nodes: Buffer,
+    leafCount: number,
+    index: number,
+  ): NativeMerkleProof;
+  merkleVerifyProofs(
+    root: Buffer,
+    proofs: NativeMerkleProof[],
+  ): Promise<boolean[]>;
+  mine(options: NativeMiningOptions): Promise<NativeMiningResult>;
+  cancelMining(): void;
+  getMiningGeneration(): number;
+  hybridHash(data: Buffer): Buffer;
+  hybridHashBatch(items: Buffer[]): Buffer;
+  getSecureMemoryStats(): SecureMemoryStats;
+  randomBytes(length: number): Buffer;
+  getEntropyStats(): EntropyStats;
+  getSecurityLogStats(): SecurityLogStats;
+  getOperationMetrics(): OperationMetrics[];
+  getHealthStatus(): HealthStatus;
+  runHealthCheck(): Promise<HealthStatus>;
+  getVerifyCacheStats(): VerifyCacheStats;
+  clearVerifyCache(): void;
+  preparePublicKey(
+    kind: PreparedKeyKind,
+    publicKey: Buffer,
+    levelOrVariant?: SecurityLevel | FalconVariant,
+  ): PreparedKeyHandle;
+  verifyPrepared(
+    handle: PreparedKeyHandle,
+    message: Buffer,
+    signature: Buffer,
+  ): Promise<boolean>;
+  verifyPreparedBatch(
+    handle: PreparedKeyHandle,
+    items: PreparedVerifyItem[],
+    earlyAbort?: boolean,
+  ): Promise<VerifyBatchResult>;
+  getPreparedKeyStats(): PreparedKeyStats;
+  setKeyPoolDepth(
+    kind: KeyPoolKind,
+    depth: number,
+    levelOrVariant?: SecurityLevel | FalconVariant,
+  ): void;
+  getKeyPoolStats(): KeyPoolStats[];
+  setWorkerThreads(threads: number): void;
+  getWorkerThreads(): number;
 }
@@ -0,0 +1,218 @@
+#include "verify_cache.h"
+#include "keccak.h"
+#include <openssl/rand.h>
+#include <cstring>
+#include <list>
+#include <mutex>
+#include <stdexcept>
+#include <unordered_map>
+
+namespace quantum
+{
+
+    namespace
+    {
+        // SHA3-256 rate in bytes
+        constexpr size_t KEY_RATE = 136;
+
+        // Takes the place of the scheme byte (at most 0x11) in keys built
+        // from a public key digest
+        constexpr uint8_t PREPARED_KEY = 0xFF;
+
+        struct KeyHash
+        {
+            size_t operator()(const VerifyCache::Key &key) const
+            {
+                // Keys are salted hashes, so any 8 bytes are uniform
+                uint64_t value;
+                std::memcpy(&value, key.data(), sizeof(value));
+                return static_cast<size_t>(value);
+            }
+        };
+
+        void absorbField(keccak::Sponge &sponge, const uint8_t *data, size_t length)
+        {
+            uint8_t prefix[8];
+            keccak::store64(prefix, static_cast<uint64_t>(length));
+            sponge.absorb(prefix, sizeof(prefix));
+            if (length > 0)
+            {
+                sponge.absorb(data, length);
+            }
+        }
+    }
+
+    struct VerifyCache::Shard
+    {
+        struct Entry
+        {
+            Key key;
+            bool valid;
+        };
+
+        std::mutex mutex;
+        std::list<Entry> lru; // most recently used at the front
+        std::unordered_map<Key, std::list<Entry>::iterator, KeyHash> index;
+    };
+
+    VerifyCache::VerifyCache(size_t capacity, size_t shards)
+        : capacity_(capacity)
+    {
+        if (shards == 0)
+        {
+            shards = 1;
+        }
+        shardCapacity_ = capacity_ == 0 ? 0 : (capacity_ + shards - 1) / shards;
+        for (size_t i = 0; i < shards; ++i)
+        {
+            shards_.push_back(std::make_unique<Shard>());
+        }
+        if (RAND_bytes(salt_, sizeof(salt_)) != 1)
+        {
+            throw std::runtime_error("Failed to generate verify cache salt");
+        }
+    }
+
+    VerifyCache::~VerifyCache() = default;
+
+    VerifyCache::Key VerifyCache::key(uint8_t scheme, const uint8_t *message, size_t messageLength,
+                                      const uint8_t *signature, size_t signatureLength,
+                                      const uint8_t *publicKey, size_t publicKeyLength) const
+    {
+        keccak::Sponge sponge(KEY_RATE, keccak::SHA3_SUFFIX);
+        sponge.absorb(salt_, sizeof(salt_));
+        sponge.absorb(&scheme, 1);
+        absorbField(sponge, message, messageLength);
+        absorbField(sponge, signature, signatureLength);
+        absorbField(sponge, publicKey, publicKeyLength);
+        sponge.finalize();
+
+        Key key;
+        sponge.squeeze(key.data(), key.size());
+        return key;
+    }
+
+    VerifyCache::Key VerifyCache::publicKeyDigest(uint8_t scheme, const uint8_t *publicKey,
+                                                  size_t publicKeyLength) const
+    {
+        keccak::Sponge sponge(KEY_RATE, keccak::SHA3_SUFFIX);
+        sponge.absorb(salt_, sizeof(salt_));
+        sponge.absorb(&PREPARED_KEY, 1);
+        sponge.absorb(&scheme, 1);
+        absorbField(sponge, publicKey, publicKeyLength);
+        sponge.finalize();
+
+        Key digest;
+        sponge.squeeze(digest.data(), digest.size());
+        return digest;
+    }
+
+    VerifyCache::Key VerifyCache::key(const Key &publicKeyDigest, const uint8_t *message, size_t messageLength,
+                                      const uint8_t *signature, size_t signatureLength) const
+    {
+        keccak::Sponge sponge(KEY_RATE, keccak::SHA3_SUFFIX);
+        sponge.absorb(salt_, sizeof(salt_));
+        sponge.absorb(&PREPARED_KEY, 1);
+        sponge.absorb(publicKeyDigest.data(), publicKeyDigest.size());
+        absorbField(sponge, message, messageLength);
+        absorbField(sponge, signature, signatureLength);
+        sponge.finalize();
+
+        Key key;
+        sponge.squeeze(key.data(), key.size());
+        return key;
+    }
+
+    VerifyCache::Shard &VerifyCache::shardFor(const Key &key) const
+    {
+        // Use bytes the bucket hash does not, so shards and buckets stay independent
+        uint64_t value;
+        std::memcpy(&value, key.data() + 8, sizeof(value));
+        return *shards_[value % shards_.size()];
+    }
+
+    bool VerifyCache::lookup(const Key &key, bool &valid)
+    {
+        if (!enabled())
+        {
+            return false;
+        }
+
+        Shard &shard = shardFor(key);
+        {
+            std::lock_guard<std::mutex> lock(shard.mutex);
+            auto it = shard.index.find(key);
+            if (it != shard.index.end())
+            {
+                shard.lru.splice(shard.lru.begin(), shard.lru, it->second);
+                valid = it->second->valid;
+                hits_.fetch_add(1, std::memory_order_relaxed);
+                if (!valid)
+                {
+                    negativeHits_.fetch_add(1, std::memory_order_relaxed);
+                }
+                return true;
+            }
+        }
+        misses_.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+
+    void VerifyCache::insert(const Key &key, bool valid)
+    {
+        if (!enabled())
+        {
+            return;
+        }
+
+        Shard &shard = shardFor(key);
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        auto it = shard.index.find(key);
+        if (it != shard.index.end())
+        {
+            // Another thread verified the same item concurrently
+            it->second->valid = valid;
+            shard.lru.splice(shard.lru.begin(), shard.lru, it->second);
+            return;
+        }
+
+        shard.lru.push_front({key, valid});
+        shard.index.emplace(key, shard.lru.begin());
+        insertions_.fetch_add(1, std::memory_order_relaxed);
+
+        if (shard.lru.size() > shardCapacity_)
+        {
+            shard.index.erase(shard.lru.back().key);
+            shard.lru.pop_back();
+            evictions_.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    void VerifyCache::clear()
+    {
+        for (auto &shard : shards_)
+        {
+            std::lock_guard<std::mutex> lock(shard->mutex);
+            shard->index.clear();
+            shard->lru.clear();
+        }
+    }
+
+    VerifyCacheStats VerifyCache::stats() const
+    {
+        VerifyCacheStats stats;
+        stats.hits = hits_.load(std::memory_order_relaxed);
+        stats.negativeHits = negativeHits_.load(std::memory_order_relaxed);
+        stats.misses = misses_.load(std::memory_order_relaxed);
+        stats.insertions = insertions_.load(std::memory_order_relaxed);
+        stats.evictions = evictions_.load(std::memory_order_relaxed);
+        stats.capacity = capacity_;
+        for (auto &shard : shards_)
+        {
+            std::lock_guard<std::mutex> lock(shard->mutex);
+            stats.entries += shard->lru.size();
+        }
+        return stats;
+    }
+
+} // namespace quantum
@@ -0,0 +1,82 @@
+#ifndef VERIFY_CACHE_H
+#define VERIFY_CACHE_H
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace quantum
+{
+
+    struct VerifyCacheStats
+    {
+        uint64_t hits{0};
+        uint64_t negativeHits{0}; // subset of hits that were known-invalid
+        uint64_t misses{0};
+        uint64_t insertions{0};
+        uint64_t evictions{0};
+        size_t entries{0};
+        size_t capacity{0};
+    };
+
+    // Bounded cache of signature verification outcomes, valid and invalid.
+    // Entries are keyed by SHA3-256 over a per-process random salt, the
+    // parameter set and the length-prefixed message, signature and public
+    // key, so keys cannot be precomputed or collided across inputs. The key
+    // space is split into independently locked LRU shards so concurrent
+    // verifiers rarely contend.
+    class VerifyCache
+    {
+    public:
+        using Key = std::array<uint8_t, 32>;
+
+        // capacity 0 disables the cache.
+        explicit VerifyCache(size_t capacity, size_t shards = 16);
+        ~VerifyCache();
+
+        VerifyCache(const VerifyCache &) = delete;
+        VerifyCache &operator=(const VerifyCache &) = delete;
+
+        bool enabled() const { return capacity_ > 0; }
+
+        Key key(uint8_t scheme, const uint8_t *message, size_t messageLength,
+                const uint8_t *signature, size_t signatureLength,
+                const uint8_t *publicKey, size_t publicKeyLength) const;
+
+        // Keys for a prepared public key: the key is digested once and the
+        // digest stands in for it, so repeat verifications hash only the
+        // message and signature. These keys never equal the ones above.
+        Key publicKeyDigest(uint8_t scheme, const uint8_t *publicKey, size_t publicKeyLength) const;
+        Key key(const Key &publicKeyDigest, const uint8_t *message, size_t messageLength,
+                const uint8_t *signature, size_t signatureLength) const;
+
+        // Returns true and sets valid when the outcome is cached.
+        bool lookup(const Key &key, bool &valid);
+        void insert(const Key &key, bool valid);
+        void clear();
+
+        VerifyCacheStats stats() const;
+
+    private:
+        struct Shard;
+
+        Shard &shardFor(const Key &key) const;
+
+        size_t capacity_;
+        size_t shardCapacity_;
+        uint8_t salt_[32];
+        std::vector<std::unique_ptr<Shard>> shards_;
+
+        std::atomic<uint64_t> hits_{0};
+        std::atomic<uint64_t> negativeHits_{0};
+        std::atomic<uint64_t> misses_{0};
+        std::atomic<uint64_t> insertions_{0};
+        std::atomic<uint64_t> evictions_{0};
+    };
+
+} // namespace quantum
+
+#endif // VERIFY_CACHE_H
@@ -1,6 +1,6 @@
 import { QuantumCrypto } from '.';
 import { Logger } from '@h3tag-blockchain/shared';
-import { SecurityLevel } from '../native/types';
+import { ParameterSetInfo, SecurityLevel } from '../native/types';
 
 export class DilithiumError extends Error {
   constructor(message: string) {
@@ -17,10 +17,10 @@ export interface DilithiumKeyPair {
 export class Dilithium {
   private static initialized = false;
   private static initPromise: Promise<void> | null = null;
-  private static readonly PUBLIC_KEY_SIZE = 2528;
-  private static readonly PRIVATE_KEY_SIZE = 2528;
-  private static readonly SIGNATURE_SIZE = 3293;
-  private static readonly DEFAULT_SECURITY_LEVEL = SecurityLevel.HIGH;
+  // Keys and signatures already in use are Dilithium5, the LEGACY set.
+  // Every call names it, so the process-wide default is left alone.
+  private static readonly SECURITY_LEVEL = SecurityLevel.LEGACY;
+  private static parameters: ParameterSetInfo | null = null;
 
   public static async initialize(): Promise<void> {
     if (this.initialized) return;
@@ -30,13 +30,11 @@ export class Dilithium {
     this.initPromise = (async () => {
       try {
         await QuantumCrypto.initialize();
-        await QuantumCrypto.nativeQuantum.setSecurityLevel(
-          this.DEFAULT_SECURITY_LEVEL,
-        );
+        this.parameterSet();
         this.initialized = true;
         Logger.info(
           'Dilithium initialized with security level:',
-          this.DEFAULT_SECURITY_LEVEL,
+          this.SECURITY_LEVEL,
         );
       } catch (error) {
         Logger.error('Dilithium initialization failed:', error);
@@ -50,11 +48,28 @@ export class Dilithium {
     return await this.initPromise;
   }
 
+  /**
+   * Key, private key and signature lengths of the parameter set this class
+   * uses, read from the native module rather than hard-coded.
+   */
+  private static parameterSet(): ParameterSetInfo {
+    if (!this.parameters) {
+      this.parameters = QuantumCrypto.nativeQuantum.getParameterSet(
+        this.SECURITY_LEVEL,
+      );
+    }
+    return this.parameters;
+  }
+
   static async generateKeyPair(entropy?: Buffer): Promise<DilithiumKeyPair> {
     if (!this.initialized) await this.initialize();
 
     try {
-      const keyPair = await QuantumCrypto.generateKeyPair(entropy);
+      const keyPair =
+        await QuantumCrypto.nativeQuantum.generateDilithiumKeyPair(
+          entropy,
+          this.SECURITY_LEVEL,
+        );
       if (!keyPair?.publicKey || !keyPair?.privateKey) {
         throw new DilithiumError('Failed to generate key pair');
       }
@@ -91,11 +106,13 @@ export class Dilithium {
       const signature = await QuantumCrypto.nativeQuantum.dilithiumSign(
         messageBuffer,
         privateKeyBuffer,
+        this.SECURITY_LEVEL,
       );
 
-      if (!(signature instanceof Buffer) || signature.length !== this.SIGNATURE_SIZE) {
+      const expectedLength = this.parameterSet().signatureLength;
+      if (!(signature instanceof Buffer) || signature.length !== expectedLength) {
         const actualLength = signature instanceof Buffer ? signature.length : 'not a Buffer';
-        throw new DilithiumError(`Invalid signature generated. Expected ${this.SIGNATURE_SIZE} bytes but got ${actualLength}.`);
+        throw new DilithiumError(`Invalid signature generated. Expected ${expectedLength} bytes but got ${actualLength}.`);
       }
 
       return signature.toString('base64');
@@ -132,6 +149,7 @@ export class Dilithium {
         messageBuffer,
         signatureBuffer,
         publicKeyBuffer,
+        this.SECURITY_LEVEL,
       );
     } catch (error) {
       Logger.error('Dilithium verification failed:', error);
@@ -144,7 +162,7 @@ export class Dilithium {
   static isValidPublicKey(publicKey: string): boolean {
     try {
       const buffer = Buffer.from(publicKey, 'base64');
-      return buffer.length === this.PUBLIC_KEY_SIZE;
+      return buffer.length === this.parameterSet().publicKeyLength;
     } catch {
       return false;
     }
@@ -153,7 +171,7 @@ export class Dilithium {
   static isValidPrivateKey(privateKey: string): boolean {
     try {
       const buffer = Buffer.from(privateKey, 'base64');
-      return buffer.length === this.PRIVATE_KEY_SIZE;
+      return buffer.length === this.parameterSet().privateKeyLength;
     } catch {
       return false;
     }
@@ -1,7 +1,6 @@
 import { QuantumKeyPair, SecurityLevel } from '../native/types';
 import { Logger } from '@h3tag-blockchain/shared';
 import nativeQuantum from '../native/quantum.node';
-import { performance } from 'perf_hooks';
 import { Kyber } from './kyber';
 
 export class QuantumError extends Error {
@@ -54,23 +53,22 @@ export class QuantumCrypto {
     }
     this.isHealthCheckRunning = true;
     try {
-      const start = performance.now();
-
-      // Test key generation
-      const testKeyPair = await this.generateKeyPair();
-      const testMessage = Buffer.from('health_check');
-      const testSignature = await this.sign(testMessage, testKeyPair.privateKey);
-      const verifyResult = await this.verify(testMessage, testSignature, testKeyPair.publicKey);
-
-      const duration = performance.now() - start;
-      Logger.debug(`Quantum health check completed in ${duration}ms`);
+      // The native known-answer tests run on their own thread; read their
+      // latest result rather than generating and signing with a fresh key.
+      let status = this.nativeQuantum.getHealthStatus();
+      if (status.pending) {
+        status = await this.nativeQuantum.runHealthCheck();
+      }
 
-      if (!verifyResult) {
-        Logger.error('Quantum health check failed: signature verification failed');
-        throw new QuantumError('Health check failed');
+      if (!status.healthy) {
+        throw new QuantumError(
+          `Known-answer tests failed (0x${status.failures.toString(16)})`,
+        );
       }
 
-      Logger.info('Quantum health check passed');
+      Logger.debug(
+        `Quantum health check passed in ${status.lastDurationMicros}us`,
+      );
     } catch (error) {
       Logger.error('Quantum health check failed:', error);
     } finally {
@@ -1,6 +1,6 @@
 import { QuantumCrypto } from '.';
 import { Logger } from '@h3tag-blockchain/shared';
-import { SecurityLevel } from '../native/types';
+import { PrivateKeyHandle, SecurityLevel } from '../native/types';
 
 export class KyberError extends Error {
   public cause?: Error;
@@ -23,7 +23,9 @@ export interface KyberEncapsulation {
 
 export class Kyber {
   public static isInitialized = false;
-  public static readonly PUBLIC_KEY_SIZE = 1184; // Kyber768 parameters
+  // Sizes of ML-KEM-768, the HIGH parameter set. Every native call names
+  // that level, so the process-wide default is left alone.
+  public static readonly PUBLIC_KEY_SIZE = 1184;
   public static readonly PRIVATE_KEY_SIZE = 2400;
   public static readonly CIPHERTEXT_SIZE = 1088;
   public static readonly SHARED_SECRET_SIZE = 32;
@@ -40,7 +42,6 @@ export class Kyber {
     this.initializationPromise = (async () => {
       try {
         await QuantumCrypto.initialize();
-        await QuantumCrypto.setSecurityLevel(this.DEFAULT_SECURITY_LEVEL);
         this.isInitialized = true;
         Logger.info(
           'Kyber initialized with security level:',
@@ -64,7 +65,9 @@ export class Kyber {
     if (!this.isInitialized) await this.initialize();
 
     try {
-      const keyPair = await QuantumCrypto.nativeQuantum.kyberGenerateKeyPair();
+      const keyPair = await QuantumCrypto.nativeQuantum.kyberGenerateKeyPair(
+        this.DEFAULT_SECURITY_LEVEL,
+      );
 
       if (!keyPair?.publicKey || !keyPair?.privateKey) {
         throw new KyberError('Failed to generate key pair');
@@ -119,8 +122,10 @@ export class Kyber {
         throw new KyberError('Invalid public key size');
       }
 
-      const result =
-        await QuantumCrypto.nativeQuantum.kyberEncapsulate(publicKeyBuffer);
+      const result = await QuantumCrypto.nativeQuantum.kyberEncapsulate(
+        publicKeyBuffer,
+        this.DEFAULT_SECURITY_LEVEL,
+      );
 
       if (
         !Buffer.isBuffer(result.ciphertext) ||
@@ -187,6 +192,7 @@ export class Kyber {
       const sharedSecret = await QuantumCrypto.nativeQuantum.kyberDecapsulate(
         ciphertextBuffer,
         privateKeyBuffer,
+        this.DEFAULT_SECURITY_LEVEL,
       );
 
       if (!Buffer.isBuffer(sharedSecret)) {
@@ -207,6 +213,205 @@ export class Kyber {
     }
   }
 
+  /**
+   * Encapsulates to many peers at once, e.g. when reconnecting to the
+   * network. The native side spreads the work over its worker pool.
+   */
+  public static async encapsulateBatch(
+    publicKeys: string[],
+  ): Promise<KyberEncapsulation[]> {
+    if (!this.isInitialized) await this.initialize();
+
+    try {
+      if (!Array.isArray(publicKeys) || publicKeys.length === 0) {
+        throw new KyberError('Missing public keys');
+      }
+
+      const publicKeyBuffers = publicKeys.map((publicKey) => {
+        if (!publicKey || !this.isValidBase64(publicKey)) {
+          throw new KyberError('Invalid public key: not a valid Base64 string');
+        }
+        const buffer = Buffer.from(publicKey, 'base64');
+        if (buffer.length !== this.PUBLIC_KEY_SIZE) {
+          throw new KyberError('Invalid public key size');
+        }
+        return buffer;
+      });
+
+      const batch = await QuantumCrypto.nativeQuantum.kyberEncapsulateBatch(
+        publicKeyBuffers,
+        this.DEFAULT_SECURITY_LEVEL,
+      );
+
+      if (
+        batch.count !== publicKeys.length ||
+        batch.ciphertextLength !== this.CIPHERTEXT_SIZE ||
+        batch.sharedSecretLength !== this.SHARED_SECRET_SIZE
+      ) {
+        throw new KyberError('Invalid result from kyberEncapsulateBatch');
+      }
+
+      return publicKeys.map((_, index) => {
+        const result = QuantumCrypto.nativeQuantum.batchEncapsulation(
+          batch,
+          index,
+        );
+        return {
+          ciphertext: result.ciphertext.toString('base64'),
+          sharedSecret: result.sharedSecret.toString('base64'),
+        };
+      });
+    } catch (error) {
+      Logger.error('Kyber batch encapsulation failed:', error);
+      throw new KyberError(
+        error instanceof Error ? error.message : 'Batch encapsulation failed',
+        error instanceof Error ? error : undefined,
+      );
+    }
+  }
+
+  public static async decapsulateBatch(
+    ciphertexts: string[],
+    privateKey: string,
+  ): Promise<string[]> {
+    if (!this.isInitialized) await this.initialize();
+
+    try {
+      if (!Array.isArray(ciphertexts) || ciphertexts.length === 0) {
+        throw new KyberError('Missing ciphertexts');
+      }
+
+      if (!privateKey || !this.isValidBase64(privateKey)) {
+        throw new KyberError(
+          'Invalid private key: not a valid Base64 string',
+        );
+      }
+
+      const privateKeyBuffer = Buffer.from(privateKey, 'base64');
+      if (privateKeyBuffer.length !== this.PRIVATE_KEY_SIZE) {
+        throw new KyberError('Invalid private key size');
+      }
+
+      const ciphertextBuffers = ciphertexts.map((ciphertext) => {
+        if (!ciphertext || !this.isValidBase64(ciphertext)) {
+          throw new KyberError('Invalid ciphertext: not a valid Base64 string');
+        }
+        const buffer = Buffer.from(ciphertext, 'base64');
+        if (buffer.length !== this.CIPHERTEXT_SIZE) {
+          throw new KyberError('Invalid ciphertext size');
+        }
+        return buffer;
+      });
+
+      const sharedSecrets =
+        await QuantumCrypto.nativeQuantum.kyberDecapsulateBatch(
+          ciphertextBuffers,
+          privateKeyBuffer,
+          this.DEFAULT_SECURITY_LEVEL,
+        );
+
+      if (
+        !Buffer.isBuffer(sharedSecrets) ||
+        sharedSecrets.length !== ciphertexts.length * this.SHARED_SECRET_SIZE
+      ) {
+        throw new KyberError('Invalid shared secrets returned');
+      }
+
+      return ciphertexts.map((_, index) =>
+        sharedSecrets
+          .subarray(
+            index * this.SHARED_SECRET_SIZE,
+            (index + 1) * this.SHARED_SECRET_SIZE,
+          )
+          .toString('base64'),
+      );
+    } catch (error) {
+      Logger.error('Kyber batch decapsulation failed:', error);
+      throw new KyberError(
+        error instanceof Error ? error.message : 'Batch decapsulation failed',
+        error instanceof Error ? error : undefined,
+      );
+    }
+  }
+
+  /**
+   * Keeps a long-lived private key natively for decapsulateWithHandle, so
+   * nodes accepting many handshakes check and decode it only once.
+   */
+  public static async loadPrivateKey(
+    privateKey: string,
+  ): Promise<PrivateKeyHandle> {
+    if (!this.isInitialized) await this.initialize();
+
+    try {
+      if (!privateKey || !this.isValidBase64(privateKey)) {
+        throw new KyberError(
+          'Invalid private key: not a valid Base64 string',
+        );
+      }
+
+      const privateKeyBuffer = Buffer.from(privateKey, 'base64');
+      if (privateKeyBuffer.length !== this.PRIVATE_KEY_SIZE) {
+        throw new KyberError('Invalid private key size');
+      }
+
+      try {
+        return QuantumCrypto.nativeQuantum.loadKyberPrivateKey(
+          privateKeyBuffer,
+          this.DEFAULT_SECURITY_LEVEL,
+        );
+      } finally {
+        privateKeyBuffer.fill(0);
+      }
+    } catch (error) {
+      Logger.error('Kyber private key load failed:', error);
+      throw new KyberError(
+        error instanceof Error ? error.message : 'Private key load failed',
+        error instanceof Error ? error : undefined,
+      );
+    }
+  }
+
+  public static async decapsulateWithHandle(
+    ciphertext: string,
+    handle: PrivateKeyHandle,
+  ): Promise<string> {
+    if (!this.isInitialized) await this.initialize();
+
+    try {
+      if (!ciphertext || !this.isValidBase64(ciphertext)) {
+        throw new KyberError('Invalid ciphertext: not a valid Base64 string');
+      }
+
+      const ciphertextBuffer = Buffer.from(ciphertext, 'base64');
+      if (ciphertextBuffer.length !== this.CIPHERTEXT_SIZE) {
+        throw new KyberError('Invalid ciphertext size');
+      }
+
+      const sharedSecret =
+        await QuantumCrypto.nativeQuantum.kyberDecapsulateWithHandle(
+          handle,
+          ciphertextBuffer,
+        );
+
+      if (sharedSecret.length !== this.SHARED_SECRET_SIZE) {
+        throw new KyberError('Invalid shared secret size');
+      }
+
+      return sharedSecret.toString('base64');
+    } catch (error) {
+      Logger.error('Kyber decapsulation failed:', error);
+      throw new KyberError(
+        error instanceof Error ? error.message : 'Decapsulation failed',
+        error instanceof Error ? error : undefined,
+      );
+    }
+  }
+
+  public static unloadPrivateKey(handle: PrivateKeyHandle): boolean {
+    return QuantumCrypto.nativeQuantum.unloadPrivateKey(handle);
+  }
+
   public static isValidPublicKey(publicKey: string): boolean {
     try {
       const buffer = Buffer.from(publicKey, 'base64');